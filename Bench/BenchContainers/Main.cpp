@@ -0,0 +1,550 @@
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <Elos/Containers/QueueSet.h>
+#include <Elos/Containers/ThreadSafePriorityQueue.h>
+#include <Elos/Containers/BinaryHeap.h>
+#include <Elos/Containers/PairingHeap.h>
+#include <Elos/Containers/SpscRingBuffer.h>
+#include <Elos/Containers/MpmcQueue.h>
+#include <Elos/Utils/Timer.h>
+#include <any>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <print>
+#include <queue>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<Elos::u64> g_allocations{ 0 };
+
+	// Keeps the optimizer from discarding popped values
+	volatile Elos::u64 g_sink = 0;
+
+	// Payload the size of a small window event
+	struct Message
+	{
+		Elos::u64 Sequence;
+		Elos::i32 X;
+		Elos::i32 Y;
+	};
+
+	// Runs producer and consumer on their own threads, returns millions of messages per second.
+	// Both sides yield when they can't make progress so the numbers stay meaningful on few cores
+	template <typename Producer, typename Consumer>
+	Elos::f64 RunPair(Elos::u64 count, Producer&& producer, Consumer&& consumer)
+	{
+		const auto start = Elos::Timer::Now();
+		std::thread producerThread([&]() { producer(count); });
+		consumer(count);
+		producerThread.join();
+		const Elos::f64 seconds = Elos::Timer::DurationInSeconds(start, Elos::Timer::Now());
+		return static_cast<Elos::f64>(count) / seconds / 1e6;
+	}
+
+	Elos::f64 BenchThreadSafeQueue(Elos::u64 count)
+	{
+		Elos::ThreadSafeQueue<Message> queue;
+		return RunPair(count,
+			[&](Elos::u64 n)
+			{
+				for (Elos::u64 i = 0; i < n; ++i)
+				{
+					queue.Push(Message{ i, 1, 2 });
+				}
+			},
+			[&](Elos::u64 n)
+			{
+				for (Elos::u64 received = 0; received < n; )
+				{
+					if (queue.TryPop())
+					{
+						++received;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+	}
+
+	constexpr Elos::u64 RingCapacity = 4096;
+	using Ring = Elos::SpscRingBuffer<Message, RingCapacity>;
+
+	Elos::f64 BenchSpsc(Elos::u64 count)
+	{
+		auto ring = std::make_unique<Ring>();
+		return RunPair(count,
+			[&](Elos::u64 n)
+			{
+				for (Elos::u64 i = 0; i < n; )
+				{
+					if (ring->TryPush(Message{ i, 1, 2 }))
+					{
+						++i;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			},
+			[&](Elos::u64 n)
+			{
+				Message message{};
+				for (Elos::u64 received = 0; received < n; )
+				{
+					if (ring->TryPop(message))
+					{
+						++received;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+	}
+
+	Elos::f64 BenchSpscBatch(Elos::u64 count)
+	{
+		constexpr Elos::u64 batchSize = 64;
+		auto ring = std::make_unique<Ring>();
+		return RunPair(count,
+			[&](Elos::u64 n)
+			{
+				std::array<Message, batchSize> batch{};
+				for (Elos::u64 i = 0; i < n; )
+				{
+					const Elos::u64 size = std::min(batchSize, n - i);
+					for (Elos::u64 j = 0; j < size; ++j)
+					{
+						batch[j] = Message{ i + j, 1, 2 };
+					}
+					const Elos::u64 pushed = ring->TryPushBatch(std::span<const Message>(batch.data(), size));
+					if (pushed == 0)
+					{
+						std::this_thread::yield();
+					}
+					i += pushed;
+				}
+			},
+			[&](Elos::u64 n)
+			{
+				std::array<Message, batchSize> batch{};
+				for (Elos::u64 received = 0; received < n; )
+				{
+					const Elos::u64 popped = ring->TryPopBatch(batch);
+					if (popped == 0)
+					{
+						std::this_thread::yield();
+					}
+					received += popped;
+				}
+			});
+	}
+
+	// N producers and N consumers through one queue using the blocking Push/WaitAndPop surface
+	template <typename Queue>
+	Elos::f64 BenchScaling(Elos::u32 threadsPerSide, Elos::u64 count)
+	{
+		auto queue = std::make_unique<Queue>();
+		const Elos::u64 perThread = count / threadsPerSide;
+
+		const auto start = Elos::Timer::Now();
+		std::vector<std::thread> threads;
+		for (Elos::u32 t = 0; t < threadsPerSide; ++t)
+		{
+			threads.emplace_back([&]()
+			{
+				for (Elos::u64 i = 0; i < perThread; ++i)
+				{
+					queue->Push(Message{ i, 1, 2 });
+				}
+			});
+			threads.emplace_back([&]()
+			{
+				for (Elos::u64 i = 0; i < perThread; ++i)
+				{
+					(void)queue->WaitAndPop();
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		const Elos::f64 seconds = Elos::Timer::DurationInSeconds(start, Elos::Timer::Now());
+		return static_cast<Elos::f64>(perThread * threadsPerSide) / seconds / 1e6;
+	}
+
+	// The queue as it was before move/drain support: copies in, copies out, one pop per lock
+	template <typename T>
+	class CopyingQueue
+	{
+	public:
+		void Push(const T& item)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_queue.push(item);
+			}
+			m_condVar.notify_one();
+		}
+
+		T WaitAndPop()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return !m_queue.empty(); });
+
+			T item = m_queue.front();
+			m_queue.pop();
+			return item;
+		}
+
+		std::optional<T> TryPop()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_queue.empty())
+			{
+				return std::nullopt;
+			}
+
+			T item = m_queue.front();
+			m_queue.pop();
+			return item;
+		}
+
+	private:
+		std::queue<T>           m_queue;
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+	};
+
+	// Stand-in for a window command: a std::any holding more than the small buffer, like a title
+	struct Command
+	{
+		Elos::u32 Type;
+		std::any  Data;
+	};
+
+	struct DrainResult
+	{
+		Elos::f64 NsPerItem;
+		Elos::f64 LocksPerFrame;
+		Elos::f64 AllocationsPerFrame;
+	};
+
+	constexpr Elos::u64 Frames        = 20'000;
+	constexpr Elos::u64 ItemsPerFrame = 64;
+
+	// Every frame the producer side queues a burst and the consumer drains it, as Window::HandleEvents does.
+	// Each queue call takes the lock exactly once, so locks are counted per call
+	template <typename Make, typename Fill, typename Drain>
+	DrainResult MeasureDrain(Make&& make, Fill&& fill, Drain&& drain)
+	{
+		Elos::u64 locks = 0;
+		const Elos::u64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 frame = 0; frame < Frames; ++frame)
+		{
+			for (Elos::u64 i = 0; i < ItemsPerFrame; ++i)
+			{
+				fill(make(i));
+			}
+			locks += drain();
+		}
+		const Elos::f64 ns = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0;
+		const Elos::u64 allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+		return DrainResult
+		{
+			.NsPerItem           = ns / static_cast<Elos::f64>(Frames * ItemsPerFrame),
+			.LocksPerFrame       = static_cast<Elos::f64>(locks) / Frames,
+			.AllocationsPerFrame = static_cast<Elos::f64>(allocations) / Frames,
+		};
+	}
+
+	template <typename T, typename Make>
+	void BenchDrain(const char* name, Make&& make)
+	{
+		CopyingQueue<T> before;
+		const DrainResult perItem = MeasureDrain(make,
+			[&](const T& item) { before.Push(item); },
+			[&]()
+			{
+				// PollEvent loop: one lock per item plus the final empty check
+				Elos::u64 locks = 1;
+				while (before.TryPop())
+				{
+					++locks;
+				}
+				return locks;
+			});
+
+		Elos::ThreadSafeQueue<T> after;
+		std::vector<T> buffer;
+		const DrainResult swapOut = MeasureDrain(make,
+			[&](T&& item) { after.Push(std::move(item)); },
+			[&]()
+			{
+				after.SwapOut(buffer);
+				return Elos::u64{ 1 };
+			});
+
+		std::println("{:>8} | copy + TryPop loop {:>6.2f} ns/item, {:>5.1f} locks/frame, {:>6.1f} allocs/frame | move + SwapOut {:>6.2f} ns/item, {:>5.1f} locks/frame, {:>6.1f} allocs/frame",
+			name, perItem.NsPerItem, perItem.LocksPerFrame, perItem.AllocationsPerFrame, swapOut.NsPerItem, swapOut.LocksPerFrame, swapOut.AllocationsPerFrame);
+	}
+
+	using QueueList = std::vector<std::unique_ptr<Elos::ThreadSafeQueue<Elos::u64>>>;
+
+	// Ping-pong through one of queueCount queues at a time, the consumer services all of them from one
+	// thread. Returns the average round trip in microseconds
+	template <typename Service>
+	Elos::f64 MeasureRoundTrip(Elos::u32 queueCount, Service&& service)
+	{
+		constexpr Elos::u64 roundTrips = 20'000;
+		QueueList queues;
+		for (Elos::u32 i = 0; i < queueCount; ++i)
+		{
+			queues.push_back(std::make_unique<Elos::ThreadSafeQueue<Elos::u64>>());
+		}
+		Elos::ThreadSafeQueue<Elos::u64> acks;
+
+		std::thread consumer([&]() { service(queues, acks, roundTrips); });
+
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 i = 0; i < roundTrips; ++i)
+		{
+			queues[i % queueCount]->Push(i);
+			(void)acks.WaitAndPop();
+		}
+		const Elos::f64 us = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now());
+		consumer.join();
+		return us / roundTrips;
+	}
+
+	void BenchWaitAny(Elos::u32 queueCount)
+	{
+		const Elos::f64 polling = MeasureRoundTrip(queueCount, [](QueueList& queues, Elos::ThreadSafeQueue<Elos::u64>& acks, Elos::u64 count)
+		{
+			// TryPop every queue in turn, yield when they're all empty
+			for (Elos::u64 received = 0; received < count; )
+			{
+				bool any = false;
+				for (auto& queue : queues)
+				{
+					if (const auto item = queue->TryPop())
+					{
+						acks.Push(*item);
+						any = true;
+						++received;
+					}
+				}
+
+				if (!any)
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		const Elos::f64 waitAny = MeasureRoundTrip(queueCount, [](QueueList& queues, Elos::ThreadSafeQueue<Elos::u64>& acks, Elos::u64 count)
+		{
+			Elos::QueueSet set;
+			for (auto& queue : queues)
+			{
+				set.Add(*queue);
+			}
+
+			for (Elos::u64 received = 0; received < count; ++received)
+			{
+				acks.Push(*queues[set.WaitAny()]->TryPop());
+			}
+		});
+
+		std::println("{:>3} queues | TryPop polling {:>7.2f} us/round trip | QueueSet::WaitAny {:>7.2f} us/round trip", queueCount, polling, waitAny);
+	}
+
+	// Two threads bounce a token through a pair of queues with blocking pops, returns us per round trip
+	template <typename Queue, typename Configure>
+	Elos::f64 MeasurePingPong(Configure&& configure)
+	{
+		constexpr Elos::u64 roundTrips = 50'000;
+		Queue ping;
+		Queue pong;
+		configure(ping);
+		configure(pong);
+
+		std::thread echo([&]()
+		{
+			for (Elos::u64 i = 0; i < roundTrips; ++i)
+			{
+				pong.Push(ping.WaitAndPop());
+			}
+		});
+
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 i = 0; i < roundTrips; ++i)
+		{
+			ping.Push(i);
+			(void)pong.WaitAndPop();
+		}
+		const Elos::f64 us = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now());
+		echo.join();
+		return us / roundTrips;
+	}
+
+	void BenchPingPong()
+	{
+		const auto none = [](auto&) {};
+		std::println("{:>28} | {:>7.2f} us/round trip", "condition_variable (before)", MeasurePingPong<CopyingQueue<Elos::u64>>(none));
+		std::println("{:>28} | {:>7.2f} us/round trip", "park on atomic::wait", MeasurePingPong<Elos::ThreadSafeQueue<Elos::u64>>(none));
+		std::println("{:>28} | {:>7.2f} us/round trip", "spin, yield, then park", MeasurePingPong<Elos::ThreadSafeQueue<Elos::u64>>(
+			[](auto& queue) { queue.SetWaitStrategy(Elos::QueueWaitStrategy::LowLatency()); }));
+	}
+
+	constexpr Elos::u64 HeapEntries = 100'000;
+
+	std::vector<Elos::u64> MakeKeys()
+	{
+		std::mt19937_64 random(42);
+		std::vector<Elos::u64> keys(HeapEntries);
+		for (Elos::u64& key : keys)
+		{
+			key = random();
+		}
+		return keys;
+	}
+
+	// Push every key then pop them all, returns ns per push+pop pair
+	template <typename Heap>
+	Elos::f64 MeasureFillDrain(const std::vector<Elos::u64>& keys)
+	{
+		Heap heap;
+		Elos::u64 sum = 0;
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 key : keys)
+		{
+			heap.Push(Elos::u64(key));
+		}
+		while (!heap.Empty())
+		{
+			sum += heap.Pop();
+		}
+		const Elos::f64 ns = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0;
+		g_sink = sum;
+		return ns / static_cast<Elos::f64>(keys.size());
+	}
+
+	// Steady state at HeapEntries items: each step pops the top and pushes a new key, returns ns per step
+	template <typename Heap>
+	Elos::f64 MeasureHold(const std::vector<Elos::u64>& keys)
+	{
+		Heap heap;
+		for (Elos::u64 key : keys)
+		{
+			heap.Push(Elos::u64(key));
+		}
+
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 i = 0; i < keys.size(); ++i)
+		{
+			const Elos::u64 top = heap.Pop();
+			heap.Push(top - (keys[i] >> 8));
+		}
+		const Elos::f64 ns = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0;
+		g_sink = heap.Top();
+		return ns / static_cast<Elos::f64>(keys.size());
+	}
+
+	// Same fill and drain through the locked queue, which adds a sequence number per entry
+	template <template <typename, typename> typename Heap>
+	Elos::f64 MeasureQueueFillDrain(const std::vector<Elos::u64>& keys)
+	{
+		Elos::ThreadSafePriorityQueue<Elos::u64, std::less<Elos::u64>, Heap> queue;
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 key : keys)
+		{
+			queue.Push(key);
+		}
+		while (queue.TryPop())
+		{
+		}
+		const Elos::f64 ns = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0;
+		return ns / static_cast<Elos::f64>(keys.size());
+	}
+
+	void BenchHeaps()
+	{
+		const std::vector<Elos::u64> keys = MakeKeys();
+		std::println("{:>12} | fill + drain {:>7.2f} ns/item | hold {:>7.2f} ns/step | ThreadSafePriorityQueue fill + drain {:>7.2f} ns/item", "BinaryHeap",
+			MeasureFillDrain<Elos::BinaryHeap<Elos::u64>>(keys), MeasureHold<Elos::BinaryHeap<Elos::u64>>(keys), MeasureQueueFillDrain<Elos::BinaryHeap>(keys));
+		std::println("{:>12} | fill + drain {:>7.2f} ns/item | hold {:>7.2f} ns/step | ThreadSafePriorityQueue fill + drain {:>7.2f} ns/item", "PairingHeap",
+			MeasureFillDrain<Elos::PairingHeap<Elos::u64>>(keys), MeasureHold<Elos::PairingHeap<Elos::u64>>(keys), MeasureQueueFillDrain<Elos::PairingHeap>(keys));
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size ? size : 1))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+int main()
+{
+	std::println("--- 1 producer -> 1 consumer, {}-byte messages ---", sizeof(Message));
+	for (Elos::u64 count : { 1'000'000ull, 10'000'000ull })
+	{
+		std::println("{:>10} messages | ThreadSafeQueue {:>8.2f} M/s | SpscRingBuffer {:>8.2f} M/s | SpscRingBuffer x64 batch {:>8.2f} M/s",
+			count, BenchThreadSafeQueue(count), BenchSpsc(count), BenchSpscBatch(count));
+	}
+
+	std::println("--- N producers -> N consumers, blocking Push/WaitAndPop, {} hardware threads ---", std::thread::hardware_concurrency());
+	for (Elos::u32 threads : { 1u, 2u, 4u, 8u, 16u })
+	{
+		constexpr Elos::u64 count = 1'000'000;
+		std::println("{:>2} + {:>2} threads | ThreadSafeQueue {:>8.2f} M/s | MpmcQueue<4096> {:>8.2f} M/s",
+			threads, threads, BenchScaling<Elos::ThreadSafeQueue<Message>>(threads, count), BenchScaling<Elos::MpmcQueue<Message, 4096>>(threads, count));
+	}
+
+	std::println("--- Per-frame drain, {} items per frame x {} frames ---", ItemsPerFrame, Frames);
+	BenchDrain<Message>("Message", [](Elos::u64 i) { return Message{ i, 1, 2 }; });
+	BenchDrain<Command>("Command", [](Elos::u64 i) { return Command{ static_cast<Elos::u32>(i), std::array<Elos::u64, 4>{ i, i, i, i } }; });
+
+	std::println("--- One consumer thread servicing N queues, ping-pong ---");
+	for (Elos::u32 queues : { 1u, 4u, 16u, 64u })
+	{
+		BenchWaitAny(queues);
+	}
+
+	std::println("--- Ping-pong between two threads, blocking WaitAndPop ---");
+	BenchPingPong();
+
+	std::println("--- Priority heaps, {} random u64 keys ---", HeapEntries);
+	BenchHeaps();
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+#include <Elos/Common/InplaceFunction.h>
+#include <Elos/Common/FunctionRef.h>
+#include <Elos/Utils/Timer.h>
+#include <functional>
+#include <memory>
+#include <print>
+#include <vector>
+
+namespace
+{
+	// Keeps the optimizer from discarding call results
+	volatile Elos::i64 g_sink = 0;
+
+	constexpr Elos::u64 FunctionCount = 1024;
+	constexpr Elos::u64 Rounds        = 10'000;
+
+	// Calls every function in the array Rounds times, returns ns per call
+	template <typename FunctionType>
+	Elos::f64 MeasureCalls(const std::vector<FunctionType>& functions)
+	{
+		Elos::i64 sum = 0;
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 round = 0; round < Rounds; ++round)
+		{
+			for (const FunctionType& function : functions)
+			{
+				sum += function(static_cast<Elos::i32>(round));
+			}
+		}
+		const Elos::f64 ns = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0;
+		g_sink = sum;
+		return ns / static_cast<Elos::f64>(Rounds * functions.size());
+	}
+
+	template <typename FunctionType, typename MakeCallable>
+	std::vector<FunctionType> MakeFunctions(MakeCallable&& make)
+	{
+		std::vector<FunctionType> functions;
+		functions.reserve(FunctionCount);
+		for (Elos::u64 i = 0; i < FunctionCount; ++i)
+		{
+			functions.push_back(make(static_cast<Elos::i64>(i)));
+		}
+		return functions;
+	}
+
+	void BenchCall()
+	{
+		// Small capture: fits std::function's small buffer on every implementation
+		const auto makeSmall = [](Elos::i64 i) { return [i](Elos::i32 v) { return v + i; }; };
+
+		// Larger capture: heap-allocated by std::function
+		const auto makeLarge = [](Elos::i64 i)
+		{
+			return [i, a = i * 2, b = i * 3, c = std::make_shared<Elos::i64>(i)](Elos::i32 v) { return v + i + a + b + *c; };
+		};
+
+		const auto smallStd     = MakeFunctions<std::function<Elos::i64(Elos::i32)>>(makeSmall);
+		const auto smallInplace = MakeFunctions<Elos::InplaceFunction<Elos::i64(Elos::i32)>>(makeSmall);
+		const auto largeStd     = MakeFunctions<std::function<Elos::i64(Elos::i32)>>(makeLarge);
+		const auto largeInplace = MakeFunctions<Elos::InplaceFunction<Elos::i64(Elos::i32), 48>>(makeLarge);
+
+		// FunctionRef refers to callables owned elsewhere
+		std::vector<decltype(makeLarge(0))> owners;
+		owners.reserve(FunctionCount);
+		for (Elos::u64 i = 0; i < FunctionCount; ++i)
+		{
+			owners.push_back(makeLarge(static_cast<Elos::i64>(i)));
+		}
+		std::vector<Elos::FunctionRef<Elos::i64(Elos::i32)>> refs;
+		refs.reserve(FunctionCount);
+		for (auto& owner : owners)
+		{
+			refs.emplace_back(owner);
+		}
+
+		std::println("{:>24} | small capture {:>6.2f} ns/call | large capture {:>6.2f} ns/call", "std::function", MeasureCalls(smallStd), MeasureCalls(largeStd));
+		std::println("{:>24} | small capture {:>6.2f} ns/call | large capture {:>6.2f} ns/call", "InplaceFunction", MeasureCalls(smallInplace), MeasureCalls(largeInplace));
+		std::println("{:>24} | {:>35} | large capture {:>6.2f} ns/call", "FunctionRef", "", MeasureCalls(refs));
+	}
+
+	// Construct + copy + destroy, the cost paid by Connect and by builders taking callbacks by value
+	template <typename FunctionType>
+	Elos::f64 MeasureConstruction()
+	{
+		constexpr Elos::u64 iterations = 2'000'000;
+		const auto shared = std::make_shared<Elos::i64>(1);
+
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 i = 0; i < iterations; ++i)
+		{
+			FunctionType function = [shared, a = static_cast<Elos::i64>(i), b = 2.0](Elos::i32 v) { return v + a + *shared + static_cast<Elos::i64>(b); };
+			FunctionType copy = function;
+			g_sink = copy(1);
+		}
+		return Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0 / iterations;
+	}
+
+	void BenchConstruction()
+	{
+		std::println("{:>24} | {:>8.2f} ns", "std::function", MeasureConstruction<std::function<Elos::i64(Elos::i32)>>());
+		std::println("{:>24} | {:>8.2f} ns", "InplaceFunction", MeasureConstruction<Elos::InplaceFunction<Elos::i64(Elos::i32)>>());
+	}
+}
+
+int main()
+{
+	std::println("--- Call overhead, {} functions x {} rounds ---", FunctionCount, Rounds);
+	BenchCall();
+
+	std::println("--- Construct + copy + call, 32-byte capture ---");
+	BenchConstruction();
+
+	return 0;
+}
@@ -0,0 +1,291 @@
+#include <Elos/Event/Signal.h>
+#include <Elos/Event/ConcurrentSignal.h>
+#include <Elos/Event/StaticSignal.h>
+#include <Elos/Utils/Timer.h>
+#include <atomic>
+#include <mutex>
+#include <print>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// Keeps the optimizer from discarding slot bodies
+	volatile Elos::i64 g_sink = 0;
+
+	struct MouseMoved
+	{
+		Elos::i32 X;
+		Elos::i32 Y;
+	};
+
+	void BenchEmit(Elos::u32 slotCount)
+	{
+		Elos::Signal<const MouseMoved&> signal;
+		std::vector<Elos::Connection<const MouseMoved&>> connections;
+		connections.reserve(slotCount);
+
+		for (Elos::u32 i = 0; i < slotCount; ++i)
+		{
+			connections.push_back(signal.Connect([](const MouseMoved& e) { g_sink = g_sink + e.X; }));
+		}
+
+		// Keep total slot invocations roughly constant across sizes
+		const Elos::u64 emits = std::max<Elos::u64>(1'000, 16'000'000 / slotCount);
+		const MouseMoved event{ 1, 2 };
+
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 i = 0; i < emits; ++i)
+		{
+			signal.Emit(event);
+		}
+		const auto end = Elos::Timer::Now();
+
+		const Elos::f64 totalNs = Elos::Timer::DurationInMicroseconds(start, end) * 1000.0;
+		std::println("{:>6} slots | {:>10.1f} ns/emit | {:>6.2f} ns/slot",
+			slotCount, totalNs / emits, totalNs / (emits * slotCount));
+	}
+
+	void BenchDisconnect(Elos::u32 slotCount)
+	{
+		Elos::Signal<const MouseMoved&> signal;
+		std::vector<Elos::Connection<const MouseMoved&>> connections;
+		connections.reserve(slotCount);
+
+		const auto connectStart = Elos::Timer::Now();
+		for (Elos::u32 i = 0; i < slotCount; ++i)
+		{
+			connections.push_back(signal.Connect([](const MouseMoved& e) { g_sink = g_sink + e.Y; }));
+		}
+		const auto connectEnd = Elos::Timer::Now();
+
+		// Disconnect from the front, the worst case for an erase-based vector
+		const auto disconnectStart = Elos::Timer::Now();
+		for (auto& connection : connections)
+		{
+			connection.Disconnect();
+		}
+		const auto disconnectEnd = Elos::Timer::Now();
+
+		std::println("{:>6} slots | connect {:>8.1f} ns/slot | disconnect {:>8.1f} ns/slot",
+			slotCount,
+			Elos::Timer::DurationInMicroseconds(connectStart, connectEnd) * 1000.0 / slotCount,
+			Elos::Timer::DurationInMicroseconds(disconnectStart, disconnectEnd) * 1000.0 / slotCount);
+	}
+
+	// Signal guarded by an external mutex, which is what callers had to do before ConcurrentSignal
+	struct LockedSignal
+	{
+		Elos::Signal<const MouseMoved&> Signal;
+		std::mutex                      Mutex;
+
+		void Emit(const MouseMoved& e)
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			Signal.Emit(e);
+		}
+
+		void Churn()
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			auto connection = Signal.Connect([](const MouseMoved&) {});
+			connection.Disconnect();
+		}
+	};
+
+	struct LockFreeSignal
+	{
+		Elos::ConcurrentSignal<const MouseMoved&> Signal;
+
+		void Emit(const MouseMoved& e)
+		{
+			Signal.Emit(e);
+		}
+
+		void Churn()
+		{
+			auto connection = Signal.Connect([](const MouseMoved&) {});
+			connection.Disconnect();
+		}
+	};
+
+	// N emitter threads and one mutator connecting/disconnecting for a fixed duration
+	template <typename SignalType>
+	void BenchContention(const char* name, Elos::u32 emitterCount)
+	{
+		constexpr Elos::f64 durationMs = 250.0;
+
+		SignalType signal;
+		for (Elos::u32 i = 0; i < 16; ++i)
+		{
+			(void)signal.Signal.Connect([](const MouseMoved& e) { g_sink = g_sink + e.X; });
+		}
+
+		std::atomic<bool>       running{ true };
+		std::atomic<Elos::u64>  totalEmits{ 0 };
+		std::atomic<Elos::u64>  totalMutations{ 0 };
+		std::vector<std::thread> threads;
+
+		for (Elos::u32 t = 0; t < emitterCount; ++t)
+		{
+			threads.emplace_back([&]()
+			{
+				const MouseMoved event{ 1, 2 };
+				Elos::u64 emits = 0;
+				while (running.load(std::memory_order_relaxed))
+				{
+					signal.Emit(event);
+					++emits;
+				}
+				totalEmits += emits;
+			});
+		}
+
+		threads.emplace_back([&]()
+		{
+			Elos::u64 mutations = 0;
+			while (running.load(std::memory_order_relaxed))
+			{
+				signal.Churn();
+				++mutations;
+			}
+			totalMutations += mutations;
+		});
+
+		std::this_thread::sleep_for(std::chrono::duration<Elos::f64, std::milli>(durationMs));
+		running = false;
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		const Elos::f64 seconds = durationMs / 1000.0;
+		std::println("{:>18} | {:>2} emitters | {:>8.2f} M emits/s | {:>8.2f} K mutations/s",
+			name, emitterCount, totalEmits / seconds / 1e6, totalMutations / seconds / 1e3);
+	}
+
+	// Four subsystems listening to the same event, wired either statically or dynamically
+	struct Subsystem
+	{
+		Elos::i64 Weight = 1;
+		void OnMouseMoved(const MouseMoved& e) { g_sink = g_sink + e.X * Weight; }
+	};
+
+	// 10k-event bursts delivered per item, slot-major through per-item slots, and to batch slots
+	void BenchBurst(Elos::u32 slotCount)
+	{
+		constexpr Elos::u64 burstSize = 10'000;
+		constexpr Elos::u64 bursts    = 200;
+
+		std::vector<MouseMoved> burst(burstSize);
+		for (Elos::u64 i = 0; i < burstSize; ++i)
+		{
+			burst[i] = MouseMoved{ static_cast<Elos::i32>(i), 1 };
+		}
+
+		Elos::Signal<const MouseMoved&> perItem;
+		Elos::Signal<const MouseMoved&> batched;
+		std::vector<Elos::Connection<const MouseMoved&>> connections;
+		for (Elos::u32 i = 0; i < slotCount; ++i)
+		{
+			connections.push_back(perItem.Connect([](const MouseMoved& e) { g_sink = g_sink + e.X; }));
+			connections.push_back(batched.Connect([](std::span<const MouseMoved> events)
+			{
+				Elos::i64 sum = 0;
+				for (const MouseMoved& e : events)
+				{
+					sum += e.X;
+				}
+				g_sink = g_sink + sum;
+			}));
+		}
+
+		const auto Measure = [&](auto&& deliver)
+		{
+			const auto start = Elos::Timer::Now();
+			for (Elos::u64 b = 0; b < bursts; ++b)
+			{
+				deliver();
+			}
+			const Elos::f64 seconds = Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) / 1e6;
+			return static_cast<Elos::f64>(burstSize * bursts) / seconds / 1e6;
+		};
+
+		const Elos::f64 emitLoop = Measure([&]() { for (const MouseMoved& e : burst) perItem.Emit(e); });
+		const Elos::f64 range    = Measure([&]() { perItem.EmitRange(burst); });
+		const Elos::f64 batch    = Measure([&]() { batched.EmitRange(burst); });
+
+		std::println("{:>4} slots | Emit loop {:>8.2f} M events/s | EmitRange {:>8.2f} M events/s | batch slots {:>8.2f} M events/s",
+			slotCount, emitLoop, range, batch);
+	}
+
+	template <typename EmitFunc>
+	Elos::f64 MeasureEmitNs(Elos::u64 iterations, EmitFunc&& emit)
+	{
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 i = 0; i < iterations; ++i)
+		{
+			emit(MouseMoved{ static_cast<Elos::i32>(i), 1 });
+		}
+		return Elos::Timer::DurationInMicroseconds(start, Elos::Timer::Now()) * 1000.0 / iterations;
+	}
+
+	void BenchStaticVersusDynamic()
+	{
+		constexpr Elos::u64 iterations = 10'000'000;
+		Subsystem renderer, audio, physics, ui;
+
+		Elos::Signal<const MouseMoved&> dynamicSignal;
+		std::vector<Elos::Connection<const MouseMoved&>> connections;
+		for (Subsystem* subsystem : { &renderer, &audio, &physics, &ui })
+		{
+			connections.push_back(dynamicSignal.Connect([subsystem](const MouseMoved& e) { subsystem->OnMouseMoved(e); }));
+		}
+
+		const Elos::StaticSignal<
+			&Subsystem::OnMouseMoved,
+			&Subsystem::OnMouseMoved,
+			&Subsystem::OnMouseMoved,
+			&Subsystem::OnMouseMoved> staticSignal(renderer, audio, physics, ui);
+
+		const Elos::f64 dynamicNs = MeasureEmitNs(iterations, [&](const MouseMoved& e) { dynamicSignal.Emit(e); });
+		const Elos::f64 staticNs  = MeasureEmitNs(iterations, [&](const MouseMoved& e) { staticSignal.Emit(e); });
+
+		std::println("{:>18} | {:>8.2f} ns/emit", "Signal", dynamicNs);
+		std::println("{:>18} | {:>8.2f} ns/emit", "StaticSignal", staticNs);
+	}
+}
+
+int main()
+{
+	std::println("--- Signal::Emit ---");
+	for (Elos::u32 slots : { 1u, 16u, 256u, 4096u })
+	{
+		BenchEmit(slots);
+	}
+
+	std::println("--- Signal::Connect / Disconnect ---");
+	for (Elos::u32 slots : { 1u, 16u, 256u, 4096u })
+	{
+		BenchDisconnect(slots);
+	}
+
+	std::println("--- Contention: N emitters + 1 mutator, 16 slots ---");
+	for (Elos::u32 emitters : { 1u, 2u, 4u, 8u })
+	{
+		BenchContention<LockedSignal>("Signal + mutex", emitters);
+		BenchContention<LockFreeSignal>("ConcurrentSignal", emitters);
+	}
+
+	std::println("--- 10k-event bursts ---");
+	for (Elos::u32 slots : { 1u, 4u, 16u, 64u })
+	{
+		BenchBurst(slots);
+	}
+
+	std::println("--- StaticSignal vs Signal, 4 member slots ---");
+	BenchStaticVersusDynamic();
+
+	return 0;
+}
@@ -0,0 +1,150 @@
+#include <Elos/Window/BasicWindowHost.h>
+#include <Elos/Utils/Timer.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <print>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::atomic<Elos::u64> g_allocations{ 0 };
+
+	constexpr Elos::u64 Updates = 5'000;
+
+	// Stand-in for the Win32 message queue: only the wake signal
+	class StandInMessageSource
+	{
+	public:
+		bool PumpMessages() { return true; }
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled; });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+			}
+			m_condVar.notify_one();
+		}
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		bool                    m_signaled = false;
+	};
+
+	struct StandInWindow
+	{
+		Elos::WindowSize Size{ 0, 0 };
+
+		void Execute(const Elos::WindowCommand::SetSize& cmd) { Size = cmd.Size; }
+		void Execute(const auto&) {}
+	};
+
+	using Host = Elos::BasicWindowHost<StandInMessageSource, StandInWindow>;
+
+	struct Result
+	{
+		Elos::f64 AverageUs;
+		Elos::f64 P99Us;
+		Elos::f64 AllocationsPerUpdate;
+	};
+
+	// Runs update Updates times, each one a size, title and position change the caller waits on
+	template <typename Update>
+	Result Measure(Update&& update)
+	{
+		std::vector<Elos::f64> samples;
+		samples.reserve(Updates);
+
+		const Elos::u64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+		for (Elos::u32 i = 1; i <= Updates; ++i)
+		{
+			const auto start = Elos::Timer::Now();
+			update(i);
+			samples.push_back(Elos::Timer::DurationInSeconds(start, Elos::Timer::Now()) * 1e6);
+		}
+		const Elos::u64 allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+		std::sort(samples.begin(), samples.end());
+		Elos::f64 total = 0.0;
+		for (const Elos::f64 sample : samples)
+		{
+			total += sample;
+		}
+		return
+		{
+			total / static_cast<Elos::f64>(samples.size()),
+			samples[samples.size() * 99 / 100],
+			static_cast<Elos::f64>(allocations) / static_cast<Elos::f64>(Updates)
+		};
+	}
+
+	void Print(const char* name, const Result& result)
+	{
+		std::println("{:<28} | round trip avg {:>7.1f} us  p99 {:>7.1f} us | allocations/update {:>5.2f}",
+			name, result.AverageUs, result.P99Us, result.AllocationsPerUpdate);
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size ? size : 1))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+int main()
+{
+	std::println("--- Three commands and a wait for all of them, {} updates, {} hardware threads ---", Updates, std::thread::hardware_concurrency());
+
+	Host host;
+	StandInWindow window;
+	const Elos::WindowId id = host.Attach(window);
+
+	Print("Wait on every command", Measure([&](Elos::u32 i)
+	{
+		host.PostAndWait(id, Elos::WindowCommand::SetSize{ { i, i } });
+		host.PostAndWait(id, Elos::WindowCommand::SetTitle{ Elos::WindowTitle("Title") });
+		host.PostAndWait(id, Elos::WindowCommand::SetPosition{ { 0, 0 } });
+	}));
+
+	Print("Post twice, wait on the last", Measure([&](Elos::u32 i)
+	{
+		host.Post(id, Elos::WindowCommand::SetSize{ { i, i } });
+		host.Post(id, Elos::WindowCommand::SetTitle{ Elos::WindowTitle("Title") });
+		host.PostAndWait(id, Elos::WindowCommand::SetPosition{ { 0, 0 } });
+	}));
+
+	Elos::BasicWindowCommandBatch<Host> batch(&host, id);
+	Print("Batch and token", Measure([&](Elos::u32 i)
+	{
+		batch.SetSize({ i, i }).SetTitle("Title").SetPosition({ 0, 0 }).Submit().Wait();
+	}));
+
+	return window.Size.Width == Updates ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+#include <Elos/Window/WindowCommand.h>
+#include <Elos/Containers/ThreadSafePriorityQueue.h>
+#include <Elos/Utils/Timer.h>
+#include <any>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <print>
+#include <string>
+
+namespace
+{
+	std::atomic<Elos::u64> g_allocations{ 0 };
+
+	// Keeps the optimizer from discarding executed commands
+	volatile Elos::u64 g_sink = 0;
+
+	constexpr Elos::u64 CommandsPerFrame = 64;
+	constexpr Elos::u64 Frames           = 20'000;
+
+	// The previous command shape: a type tag and a std::any payload, copied out with any_cast
+	struct AnyCommand
+	{
+		Elos::WindowCommandType type;
+		std::any                data;
+		std::promise<void>*     completion = nullptr;
+	};
+
+	struct AnyCommandOrder
+	{
+		bool operator()(const AnyCommand& a, const AnyCommand& b) const
+		{
+			return Elos::WindowCommandOrder::GetPriority(a.type) < Elos::WindowCommandOrder::GetPriority(b.type);
+		}
+	};
+
+	// Does what the window thread would, minus the Win32 calls
+	struct SinkExecutor
+	{
+		void operator()(const Elos::WindowCommand::SetPosition& cmd) const { g_sink = g_sink + static_cast<Elos::u64>(cmd.Position.X); }
+		void operator()(const Elos::WindowCommand::SetSize& cmd) const     { g_sink = g_sink + cmd.Size.Width; }
+		void operator()(const Elos::WindowCommand::SetTitle& cmd) const    { g_sink = g_sink + cmd.Title.Size(); }
+		void operator()(const auto&) const {}
+	};
+
+	void ExecuteAny(const AnyCommand& cmd)
+	{
+		switch (cmd.type)
+		{
+		case Elos::WindowCommandType::SetPosition:
+			g_sink = g_sink + static_cast<Elos::u64>(std::any_cast<Elos::WindowPosition>(cmd.data).X);
+			break;
+		case Elos::WindowCommandType::SetSize:
+			g_sink = g_sink + std::any_cast<Elos::WindowSize>(cmd.data).Width;
+			break;
+		case Elos::WindowCommandType::SetTitle:
+			g_sink = g_sink + std::any_cast<Elos::String>(cmd.data).size();
+			break;
+		default:
+			break;
+		}
+	}
+
+	struct Result
+	{
+		Elos::f64 NsPerCommand;
+		Elos::f64 AllocationsPerCommand;
+	};
+
+	// Queues a frame's worth of commands from the caller, then drains and executes them, as
+	// Window and WindowThread do. The first frame warms the queue's storage and isn't counted
+	template <typename Queue, typename MakeCommand, typename Execute>
+	Result Measure(MakeCommand&& makeCommand, Execute&& execute)
+	{
+		Queue queue;
+		const auto runFrame = [&](Elos::u64 frame)
+		{
+			for (Elos::u64 i = 0; i < CommandsPerFrame; ++i)
+			{
+				queue.Push(makeCommand(frame * CommandsPerFrame + i));
+			}
+			while (auto cmd = queue.TryPop())
+			{
+				execute(*cmd);
+			}
+		};
+
+		runFrame(0);
+		const Elos::u64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+		const auto start = Elos::Timer::Now();
+		for (Elos::u64 frame = 1; frame <= Frames; ++frame)
+		{
+			runFrame(frame);
+		}
+		const Elos::f64 seconds = Elos::Timer::DurationInSeconds(start, Elos::Timer::Now());
+		const Elos::u64 allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+		constexpr Elos::f64 commands = static_cast<Elos::f64>(CommandsPerFrame * Frames);
+		return { seconds * 1e9 / commands, static_cast<Elos::f64>(allocations) / commands };
+	}
+
+	template <typename MakeAny, typename MakeTyped>
+	void Bench(const char* name, MakeAny&& makeAny, MakeTyped&& makeTyped)
+	{
+		using AnyQueue   = Elos::ThreadSafePriorityQueue<AnyCommand, AnyCommandOrder>;
+		using TypedQueue = Elos::ThreadSafePriorityQueue<Elos::WindowCommand, Elos::WindowCommandOrder>;
+
+		const Result any   = Measure<AnyQueue>(makeAny, [](const AnyCommand& cmd) { ExecuteAny(cmd); });
+		const Result typed = Measure<TypedQueue>(makeTyped, [](Elos::WindowCommand& cmd) { Elos::ExecuteWindowCommand(cmd, SinkExecutor{}); });
+
+		std::println("{:<18} | std::any {:>7.1f} ns {:>5.2f} allocs | WindowCommand {:>7.1f} ns {:>5.2f} allocs",
+			name, any.NsPerCommand, any.AllocationsPerCommand, typed.NsPerCommand, typed.AllocationsPerCommand);
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size ? size : 1))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+int main()
+{
+	using namespace Elos;
+
+	std::println("--- Queue, drain and execute, {} commands per frame x {} frames, per command ({}-byte WindowCommand, {}-byte std::any command) ---",
+		CommandsPerFrame, Frames, sizeof(WindowCommand), sizeof(AnyCommand));
+
+	Bench("SetPosition",
+		[](u64 i) { return AnyCommand{ WindowCommandType::SetPosition, WindowPosition{ static_cast<i32>(i), 0 } }; },
+		[](u64 i) { return WindowCommand{ WindowCommand::SetPosition{ { static_cast<i32>(i), 0 } } }; });
+
+	Bench("SetSize",
+		[](u64 i) { return AnyCommand{ WindowCommandType::SetSize, WindowSize{ static_cast<u32>(i), 1 } }; },
+		[](u64 i) { return WindowCommand{ WindowCommand::SetSize{ { static_cast<u32>(i), 1 } } }; });
+
+	const String shortTitle = "Elos - Untitled Document";
+	Bench("SetTitle (short)",
+		[&](u64) { return AnyCommand{ WindowCommandType::SetTitle, shortTitle }; },
+		[&](u64) { return WindowCommand{ WindowCommand::SetTitle{ WindowTitle(shortTitle) } }; });
+
+	const String longTitle(WindowTitle::GetCapacity() * 2, 'x');
+	Bench("SetTitle (long)",
+		[&](u64) { return AnyCommand{ WindowCommandType::SetTitle, longTitle }; },
+		[&](u64) { return WindowCommand{ WindowCommand::SetTitle{ WindowTitle(longTitle) } }; });
+
+	return 0;
+}
@@ -0,0 +1,130 @@
+#include <Elos/Window/WindowEventQueue.h>
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <Elos/Utils/Timer.h>
+#include <array>
+#include <atomic>
+#include <print>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr Elos::u64 Events = 2'000'000;
+
+	// Keeps the optimizer from discarding polled events
+	std::atomic<Elos::u64> g_sink{ 0 };
+
+	// A synthetic host thread pushes key presses as fast as the queue takes them while the caller
+	// polls the way its frame loop would. Lossless on both sides, so the rate is events delivered
+	template <typename Push, typename Poll>
+	Elos::f64 Measure(Push&& push, Poll&& poll)
+	{
+		const auto start = Elos::Timer::Now();
+		std::thread producer([&]()
+		{
+			for (Elos::u64 i = 0; i < Events; ++i)
+			{
+				push(Elos::Event(Elos::Event::KeyPressed{ static_cast<Elos::KeyCode::Key>(i & 0x3F), false, false, false, false }));
+			}
+		});
+
+		Elos::u64 received = 0;
+		Elos::u64 sum = 0;
+		while (received < Events)
+		{
+			const Elos::u64 polled = poll(sum);
+			received += polled;
+			if (polled == 0)
+			{
+				std::this_thread::yield();
+			}
+		}
+		producer.join();
+		g_sink.fetch_add(sum, std::memory_order_relaxed);
+
+		return static_cast<Elos::f64>(Events) / Elos::Timer::DurationInSeconds(start, Elos::Timer::Now());
+	}
+
+	Elos::u64 Sum(const Elos::Event& event)
+	{
+		const auto* key = event.Get<Elos::Event::KeyPressed>();
+		return key ? static_cast<Elos::u64>(key->Key) : 0;
+	}
+}
+
+int main()
+{
+	std::println("--- Window events from a synthetic producer, {} events, {} hardware threads ---", Events, std::thread::hardware_concurrency());
+
+	{
+		// The previous path: mutex, deque and condition variable per push, one PollEvent per event
+		Elos::ThreadSafeQueue<Elos::Event> queue(4096);
+		const Elos::f64 rate = Measure(
+			[&](const Elos::Event& event) { queue.Push(event); },
+			[&](Elos::u64& sum)
+			{
+				Elos::u64 polled = 0;
+				while (const std::optional<Elos::Event> event = queue.TryPop())
+				{
+					sum += Sum(*event);
+					++polled;
+				}
+				return polled;
+			});
+		std::println("{:<34} | {:>7.2f} M events/s", "ThreadSafeQueue, PollEvent", rate / 1e6);
+	}
+
+	{
+		// The previous HandleEvents: one locked SwapOut into a reused vector
+		Elos::ThreadSafeQueue<Elos::Event> queue(4096);
+		std::vector<Elos::Event> events;
+		const Elos::f64 rate = Measure(
+			[&](const Elos::Event& event) { queue.Push(event); },
+			[&](Elos::u64& sum)
+			{
+				queue.SwapOut(events);
+				for (const Elos::Event& event : events)
+				{
+					sum += Sum(event);
+				}
+				return static_cast<Elos::u64>(events.size());
+			});
+		std::println("{:<34} | {:>7.2f} M events/s", "ThreadSafeQueue, SwapOut", rate / 1e6);
+	}
+
+	{
+		Elos::WindowEventQueue queue;
+		const Elos::f64 rate = Measure(
+			[&](const Elos::Event& event) { queue.Push(event); },
+			[&](Elos::u64& sum)
+			{
+				Elos::u64 polled = 0;
+				while (const std::optional<Elos::Event> event = queue.TryPop())
+				{
+					sum += Sum(*event);
+					++polled;
+				}
+				return polled;
+			});
+		std::println("{:<34} | {:>7.2f} M events/s", "WindowEventQueue, PollEvent", rate / 1e6);
+	}
+
+	{
+		Elos::WindowEventQueue queue;
+		std::array<Elos::Event, 64> events;
+		const Elos::f64 rate = Measure(
+			[&](const Elos::Event& event) { queue.Push(event); },
+			[&](Elos::u64& sum)
+			{
+				const Elos::u64 polled = queue.PopBatch(events);
+				for (Elos::u64 i = 0; i < polled; ++i)
+				{
+					sum += Sum(events[i]);
+				}
+				return polled;
+			});
+		std::println("{:<34} | {:>7.2f} M events/s", "WindowEventQueue, PollEvents(span)", rate / 1e6);
+	}
+
+	return 0;
+}
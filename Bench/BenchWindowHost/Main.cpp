@@ -0,0 +1,135 @@
+#include <Elos/Window/BasicWindowHost.h>
+#include <Elos/Utils/Timer.h>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <print>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Stand-in for the Win32 message queue: only the wake signal
+	class StandInMessageSource
+	{
+	public:
+		bool PumpMessages() { return true; }
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled; });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+			}
+			m_condVar.notify_one();
+		}
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		bool                    m_signaled = false;
+	};
+
+	// Stand-in for a window's thread-side state
+	struct StandInWindow
+	{
+		Elos::WindowSize Size{ 0, 0 };
+
+		void Execute(const Elos::WindowCommand::Create& cmd) { Size = cmd.Info.Size; }
+		void Execute(const Elos::WindowCommand::SetSize& cmd) { Size = cmd.Size; }
+		void Execute(const auto&) {}
+	};
+
+	using Host = Elos::BasicWindowHost<StandInMessageSource, StandInWindow>;
+	using HostPool = Elos::BasicWindowHostPool<Host>;
+
+	// A field of /proc/self/status, e.g. "Threads" or "VmRSS" (in kB). Nullopt where that isn't available
+	std::optional<Elos::u64> ReadProcessStatus(const std::string& field)
+	{
+		std::ifstream status("/proc/self/status");
+		std::string line;
+		while (std::getline(status, line))
+		{
+			if (line.starts_with(field + ":"))
+			{
+				return std::stoull(line.substr(field.size() + 1));
+			}
+		}
+		return std::nullopt;
+	}
+
+	std::string Format(std::optional<Elos::u64> value)
+	{
+		return value ? std::to_string(*value) : "n/a";
+	}
+
+	// A window as Window holds it: its state, its host and the id the host routes by
+	struct HostedWindow
+	{
+		std::unique_ptr<StandInWindow> State = std::make_unique<StandInWindow>();
+		std::shared_ptr<Host>          Owner;
+		Elos::WindowId                 Id = 0;
+	};
+
+	// Creates count windows, taking a host for each from pickHost, and reports what that cost
+	template <typename PickHost>
+	void Measure(const char* mode, Elos::u32 count, PickHost&& pickHost)
+	{
+		const std::optional<Elos::u64> rssBefore = ReadProcessStatus("VmRSS");
+
+		std::vector<HostedWindow> windows(count);
+		const auto start = Elos::Timer::Now();
+		for (HostedWindow& window : windows)
+		{
+			window.Owner = pickHost();
+			window.Id = window.Owner->Attach(*window.State);
+
+			Elos::WindowCreateInfo info;
+			info.Size = { 800, 600 };
+			window.Owner->PostAndWait(window.Id, Elos::WindowCommand::Create{ std::move(info) });
+		}
+		const Elos::f64 createMs = Elos::Timer::DurationInSeconds(start, Elos::Timer::Now()) * 1e3;
+
+		const std::optional<Elos::u64> threads = ReadProcessStatus("Threads");
+		const std::optional<Elos::u64> rssAfter = ReadProcessStatus("VmRSS");
+		std::optional<Elos::u64> rssDelta;
+		if (rssBefore && rssAfter)
+		{
+			rssDelta = *rssAfter > *rssBefore ? *rssAfter - *rssBefore : 0;
+		}
+
+		std::println("{:<18} {:>5} windows | create {:>9.2f} ms ({:>7.2f} us each) | threads {:>5} | RSS +{:>7} kB",
+			mode, count, createMs, createMs * 1e3 / count, Format(threads), Format(rssDelta));
+
+		for (HostedWindow& window : windows)
+		{
+			window.Owner->Detach(window.Id);
+		}
+	}
+}
+
+int main()
+{
+	std::println("--- Window creation against a stand-in backend ---");
+	for (const Elos::u32 count : { 1u, 100u, 1000u })
+	{
+		Measure("Thread per window", count, []() { return std::make_shared<Host>(); });
+
+		const auto shared = std::make_shared<Host>();
+		Measure("One shared host", count, [&]() { return shared; });
+
+		HostPool pool(4);
+		Measure("Pool of 4 hosts", count, [&]() { return pool.Pick(); });
+	}
+
+	return 0;
+}
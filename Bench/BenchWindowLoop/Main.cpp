@@ -0,0 +1,154 @@
+#include <Elos/Window/WindowLoop.h>
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <Elos/Utils/Timer.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <print>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr Elos::u64 RoundTrips = 2'000;
+
+	// A message source with no messages, only the wake signal
+	class SignalSource
+	{
+	public:
+		bool PumpMessages() { return true; }
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled; });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+			}
+			m_condVar.notify_one();
+		}
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		bool                    m_signaled = false;
+	};
+
+	struct Result
+	{
+		Elos::f64 AverageUs;
+		Elos::f64 P99Us;
+		Elos::f64 IdleWakesPerSecond;
+	};
+
+	// Posts a command, waits for the window thread to acknowledge it, repeat. Then leaves the thread
+	// idle for a while and counts how often it woke anyway
+	template <typename Loop>
+	Result Measure(Loop& loop)
+	{
+		Elos::ThreadSafeQueue<Elos::u64> commands;
+		std::atomic<Elos::u64> acknowledged{ 0 };
+		std::atomic<Elos::u64> passes{ 0 };
+
+		std::thread windowThread([&]()
+		{
+			loop.Run([&]()
+			{
+				passes.fetch_add(1, std::memory_order_relaxed);
+				while (const std::optional<Elos::u64> command = commands.TryPop())
+				{
+					acknowledged.store(*command, std::memory_order_release);
+					acknowledged.notify_one();
+				}
+			});
+		});
+
+		std::vector<Elos::f64> samples;
+		samples.reserve(RoundTrips);
+		for (Elos::u64 i = 1; i <= RoundTrips; ++i)
+		{
+			const auto start = Elos::Timer::Now();
+			commands.Push(i);
+			loop.Notify();
+			for (Elos::u64 seen = acknowledged.load(std::memory_order_acquire); seen != i; seen = acknowledged.load(std::memory_order_acquire))
+			{
+				acknowledged.wait(seen, std::memory_order_acquire);
+			}
+			samples.push_back(Elos::Timer::DurationInSeconds(start, Elos::Timer::Now()) * 1e6);
+		}
+
+		constexpr auto idle = std::chrono::milliseconds(200);
+		const Elos::u64 passesBefore = passes.load(std::memory_order_relaxed);
+		std::this_thread::sleep_for(idle);
+		const Elos::u64 idlePasses = passes.load(std::memory_order_relaxed) - passesBefore;
+
+		loop.Stop();
+		windowThread.join();
+
+		std::sort(samples.begin(), samples.end());
+		Elos::f64 total = 0.0;
+		for (const Elos::f64 sample : samples)
+		{
+			total += sample;
+		}
+		return
+		{
+			total / static_cast<Elos::f64>(samples.size()),
+			samples[samples.size() * 99 / 100],
+			static_cast<Elos::f64>(idlePasses) / std::chrono::duration<Elos::f64>(idle).count()
+		};
+	}
+
+	// The previous WindowThread loop: process, pump, then sleep a millisecond whenever nothing was queued
+	class SleepPollingLoop
+	{
+	public:
+		template <typename ProcessCommands>
+		void Run(ProcessCommands&& processCommands)
+		{
+			while (m_running.load(std::memory_order_acquire))
+			{
+				processCommands();
+				if (!m_pending.exchange(false, std::memory_order_acq_rel))
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+		}
+
+		void Notify() { m_pending.store(true, std::memory_order_release); }
+		void Stop() { m_running.store(false, std::memory_order_release); }
+
+	private:
+		std::atomic<bool> m_running{ true };
+		std::atomic<bool> m_pending{ false };
+	};
+
+	void Print(const char* name, const Result& result)
+	{
+		std::println("{:<22} | round trip avg {:>9.1f} us  p99 {:>9.1f} us | idle wakeups {:>7.1f} /s",
+			name, result.AverageUs, result.P99Us, result.IdleWakesPerSecond);
+	}
+}
+
+int main()
+{
+	std::println("--- Command round trip to a window thread, {} commands, {} hardware threads ---", RoundTrips, std::thread::hardware_concurrency());
+
+	SleepPollingLoop polling;
+	Print("1 ms sleep polling", Measure(polling));
+
+	SignalSource source;
+	Elos::WindowLoop<SignalSource> loop(source);
+	Print("WindowLoop", Measure(loop));
+
+	return 0;
+}
@@ -0,0 +1,156 @@
+#include <Elos/Window/BasicWindowHost.h>
+#include <Elos/Window/BasicWindowPool.h>
+#include <Elos/Utils/Timer.h>
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <vector>
+
+namespace
+{
+	constexpr Elos::u32 Popups = 2'000;
+
+	// Stand-in for the Win32 message queue: only the wake signal
+	class StandInMessageSource
+	{
+	public:
+		bool PumpMessages() { return true; }
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled; });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+			}
+			m_condVar.notify_one();
+		}
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		bool                    m_signaled = false;
+	};
+
+	struct StandInState
+	{
+		bool Open = false;
+
+		void Execute(const Elos::WindowCommand::Create&) { Open = true; }
+		void Execute(const Elos::WindowCommand::Close&) { Open = false; }
+		void Execute(const auto&) {}
+	};
+
+	using Host = Elos::BasicWindowHost<StandInMessageSource, StandInState>;
+
+	// Stands in for Window as it is built without a host: a host thread of its own, a blocking
+	// Create, and a blocking Close plus join on destruction. The Win32 calls themselves are left out
+	class StandInWindow
+	{
+	public:
+		explicit StandInWindow(const Elos::WindowCreateInfo& info)
+			: m_host(std::make_shared<Host>())
+		{
+			m_id = m_host->Attach(m_state);
+			m_host->PostAndWait(m_id, Elos::WindowCommand::Create{ info });
+		}
+
+		~StandInWindow()
+		{
+			m_host->PostAndWait(m_id, Elos::WindowCommand::Close{});
+			m_host->Detach(m_id);
+		}
+
+		NODISCARD bool IsOpen() const { return m_state.Open; }
+		NODISCARD Elos::BasicWindowCommandBatch<Host> BeginCommands() { return { m_host.get(), m_id }; }
+		void DiscardEvents() {}
+
+	private:
+		std::shared_ptr<Host> m_host;
+		StandInState          m_state;
+		Elos::WindowId        m_id = 0;
+	};
+
+	struct Result
+	{
+		Elos::f64 AverageUs;
+		Elos::f64 P99Us;
+		Elos::f64 ReleaseUs;
+	};
+
+	Result Summarize(std::vector<Elos::f64>& samples, Elos::f64 releaseSeconds)
+	{
+		std::sort(samples.begin(), samples.end());
+		Elos::f64 total = 0.0;
+		for (const Elos::f64 sample : samples)
+		{
+			total += sample;
+		}
+		return
+		{
+			total / static_cast<Elos::f64>(samples.size()),
+			samples[samples.size() * 99 / 100],
+			releaseSeconds * 1e6 / static_cast<Elos::f64>(samples.size())
+		};
+	}
+
+	void Print(const char* name, const Result& result)
+	{
+		std::println("{:<22} | show avg {:>8.1f} us  p99 {:>8.1f} us | release avg {:>8.1f} us",
+			name, result.AverageUs, result.P99Us, result.ReleaseUs);
+	}
+}
+
+int main()
+{
+	std::println("--- Showing and dismissing a popup, {} times, stand-in backend ---", Popups);
+	const Elos::WindowCreateInfo popup = Elos::WindowCreateInfo::Default("Tooltip", { 240, 60 }, Elos::WindowStyle::None);
+
+	{
+		std::vector<Elos::f64> samples;
+		samples.reserve(Popups);
+		Elos::f64 releaseSeconds = 0.0;
+		for (Elos::u32 i = 0; i < Popups; ++i)
+		{
+			const auto start = Elos::Timer::Now();
+			auto window = std::make_shared<StandInWindow>(popup);
+			const auto shown = Elos::Timer::Now();
+			window.reset();
+			samples.push_back(Elos::Timer::DurationInSeconds(start, shown) * 1e6);
+			releaseSeconds += Elos::Timer::DurationInSeconds(shown, Elos::Timer::Now());
+		}
+		Print("Cold make_shared", Summarize(samples, releaseSeconds));
+	}
+
+	{
+		Elos::BasicWindowPool<StandInWindow> pool(popup, 4);
+		std::vector<Elos::f64> samples;
+		samples.reserve(Popups);
+		Elos::f64 releaseSeconds = 0.0;
+		for (Elos::u32 i = 0; i < Popups; ++i)
+		{
+			const auto start = Elos::Timer::Now();
+			auto window = pool.Acquire(popup);
+			const auto shown = Elos::Timer::Now();
+			pool.Release(std::move(window));
+			samples.push_back(Elos::Timer::DurationInSeconds(start, shown) * 1e6);
+			releaseSeconds += Elos::Timer::DurationInSeconds(shown, Elos::Timer::Now());
+		}
+		Print("WindowPool of 4", Summarize(samples, releaseSeconds));
+
+		const Elos::WindowPoolStats stats = pool.GetStats();
+		std::println("{:<22} | hit rate {:>5.1f}% | acquire avg {:>8.1f} us  p99 < {:>8.1f} us",
+			"", stats.HitRate() * 100.0, stats.AcquireLatency.AverageMs() * 1e3,
+			static_cast<Elos::f64>(stats.AcquireLatency.PercentileNs(0.99)) / 1e3);
+	}
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include <Elos/Containers/SeqLock.h>
+#include <Elos/Utils/Timer.h>
+#include <Elos/Window/WindowTypes.h>
+#include <atomic>
+#include <mutex>
+#include <print>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr Elos::u64 ReadsPerThread = 2'000'000;
+
+	// Keeps the optimizer from discarding reads
+	std::atomic<Elos::u64> g_sink{ 0 };
+
+	// The previous getters: the window's recursive mutex around each field
+	class MutexState
+	{
+	public:
+		Elos::WindowSize GetSize() const
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+			return m_state.Size;
+		}
+
+		void SetSize(const Elos::WindowSize& size)
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+			m_state.Size = size;
+		}
+
+	private:
+		mutable std::recursive_mutex m_mutex;
+		Elos::WindowState            m_state;
+	};
+
+	class SeqLockState
+	{
+	public:
+		Elos::WindowSize GetSize() const { return m_state.Load().Size; }
+		void SetSize(const Elos::WindowSize& size) { m_state.Update([&](Elos::WindowState& state) { state.Size = size; }); }
+
+	private:
+		Elos::SeqLock<Elos::WindowState> m_state;
+	};
+
+	struct Result
+	{
+		Elos::f64 NsPerRead;
+		Elos::f64 WritesPerSecond;
+	};
+
+	// readers threads call GetSize while one thread resizes as fast as it can, like a window being dragged
+	template <typename State>
+	Result Measure(Elos::u32 readers)
+	{
+		State state;
+		std::atomic<bool> reading{ true };
+		std::atomic<Elos::u64> writes{ 0 };
+
+		std::thread writer([&]()
+		{
+			Elos::u32 i = 0;
+			while (reading.load(std::memory_order_relaxed))
+			{
+				++i;
+				state.SetSize({ i, i });
+				writes.fetch_add(1, std::memory_order_relaxed);
+			}
+		});
+
+		const auto start = Elos::Timer::Now();
+		std::vector<std::thread> threads;
+		for (Elos::u32 r = 0; r < readers; ++r)
+		{
+			threads.emplace_back([&]()
+			{
+				Elos::u64 sum = 0;
+				for (Elos::u64 i = 0; i < ReadsPerThread; ++i)
+				{
+					sum += state.GetSize().Width;
+				}
+				g_sink.fetch_add(sum, std::memory_order_relaxed);
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		const Elos::f64 seconds = Elos::Timer::DurationInSeconds(start, Elos::Timer::Now());
+		reading.store(false, std::memory_order_relaxed);
+		writer.join();
+
+		return
+		{
+			seconds * 1e9 / static_cast<Elos::f64>(ReadsPerThread),
+			static_cast<Elos::f64>(writes.load()) / seconds
+		};
+	}
+
+	void Print(const char* name, Elos::u32 readers, const Result& result)
+	{
+		std::println("{:<16} {} reader(s) | {:>7.1f} ns per GetSize | {:>7.2f} M resizes/s alongside",
+			name, readers, result.NsPerRead, result.WritesPerSecond / 1e6);
+	}
+}
+
+int main()
+{
+	std::println("--- GetSize under continuous resizes, {} reads per reader, {} hardware threads ---", ReadsPerThread, std::thread::hardware_concurrency());
+	for (const Elos::u32 readers : { 1u, 4u })
+	{
+		Print("recursive_mutex", readers, Measure<MutexState>(readers));
+		Print("SeqLock", readers, Measure<SeqLockState>(readers));
+	}
+
+	return 0;
+}
@@ -13,21 +13,23 @@ namespace Elos
 
 	void AppBase::ProcessWindowEvents()
 	{
-		// Bind these lambdas to fire off the signals
-		static const auto OnWindowClosed              = [this](const Event::Closed& e)              { m_windowEventSignals.OnClosed.Emit(e);              };
-		static const auto OnWindowFocusLost           = [this](const Event::FocusLost& e)           { m_windowEventSignals.OnFocusLost.Emit(e);           };
-		static const auto OnWindowFocusGained         = [this](const Event::FocusGained& e)         { m_windowEventSignals.OnFocusGained.Emit(e);         };
-		static const auto OnWindowMouseEntered        = [this](const Event::MouseEntered& e)        { m_windowEventSignals.OnMouseEntered.Emit(e);        };
-		static const auto OnWindowMouseLeft           = [this](const Event::MouseLeft& e)           { m_windowEventSignals.OnMouseLeft.Emit(e);           };
-		static const auto OnWindowResized             = [this](const Event::Resized& e)             { m_windowEventSignals.OnResized.Emit(e);             };
-		static const auto OnWindowTextInput           = [this](const Event::TextInput& e)           { m_windowEventSignals.OnTextInput.Emit(e);           };
-		static const auto OnWindowKeyPressed          = [this](const Event::KeyPressed& e)          { m_windowEventSignals.OnKeyPressed.Emit(e);          };
-		static const auto OnWindowKeyReleased         = [this](const Event::KeyReleased& e)         { m_windowEventSignals.OnKeyReleased.Emit(e);         };
-		static const auto OnWindowMouseWheelScrolled  = [this](const Event::MouseWheelScrolled& e)  { m_windowEventSignals.OnMouseWheelScrolled.Emit(e);  };
-		static const auto OnWindowMouseButtonPressed  = [this](const Event::MouseButtonPressed& e)  { m_windowEventSignals.OnMouseButtonPressed.Emit(e);  };
-		static const auto OnWindowMouseButtonReleased = [this](const Event::MouseButtonReleased& e) { m_windowEventSignals.OnMouseButtonReleased.Emit(e); };
-		static const auto OnWindowMouseMoved          = [this](const Event::MouseMoved& e)          { m_windowEventSignals.OnMouseMoved.Emit(e);          };
-		static const auto OnWindowMouseMovedRaw       = [this](const Event::MouseMovedRaw& e)       { m_windowEventSignals.OnMouseMovedRaw.Emit(e);       };
+		// Bind these lambdas to fire off the signals. Mouse moves arrive in bursts, so they are batched and
+		// emitted slot-major; any other event flushes both runs first to keep the overall order. Moves and
+		// raw moves interleave per input report but go to different signals, so each keeps its own run
+		const auto OnWindowClosed              = [this](const Event::Closed& e)              { FlushMouseMoves(); m_windowEventSignals.OnClosed.Emit(e);              };
+		const auto OnWindowFocusLost           = [this](const Event::FocusLost& e)           { FlushMouseMoves(); m_windowEventSignals.OnFocusLost.Emit(e);           };
+		const auto OnWindowFocusGained         = [this](const Event::FocusGained& e)         { FlushMouseMoves(); m_windowEventSignals.OnFocusGained.Emit(e);         };
+		const auto OnWindowMouseEntered        = [this](const Event::MouseEntered& e)        { FlushMouseMoves(); m_windowEventSignals.OnMouseEntered.Emit(e);        };
+		const auto OnWindowMouseLeft           = [this](const Event::MouseLeft& e)           { FlushMouseMoves(); m_windowEventSignals.OnMouseLeft.Emit(e);           };
+		const auto OnWindowResized             = [this](const Event::Resized& e)             { FlushMouseMoves(); m_windowEventSignals.OnResized.Emit(e);             };
+		const auto OnWindowTextInput           = [this](const Event::TextInput& e)           { FlushMouseMoves(); m_windowEventSignals.OnTextInput.Emit(e);           };
+		const auto OnWindowKeyPressed          = [this](const Event::KeyPressed& e)          { FlushMouseMoves(); m_windowEventSignals.OnKeyPressed.Emit(e);          };
+		const auto OnWindowKeyReleased         = [this](const Event::KeyReleased& e)         { FlushMouseMoves(); m_windowEventSignals.OnKeyReleased.Emit(e);         };
+		const auto OnWindowMouseWheelScrolled  = [this](const Event::MouseWheelScrolled& e)  { FlushMouseMoves(); m_windowEventSignals.OnMouseWheelScrolled.Emit(e);  };
+		const auto OnWindowMouseButtonPressed  = [this](const Event::MouseButtonPressed& e)  { FlushMouseMoves(); m_windowEventSignals.OnMouseButtonPressed.Emit(e);  };
+		const auto OnWindowMouseButtonReleased = [this](const Event::MouseButtonReleased& e) { FlushMouseMoves(); m_windowEventSignals.OnMouseButtonReleased.Emit(e); };
+		const auto OnWindowMouseMoved          = [this](const Event::MouseMoved& e)          { m_mouseMovedRun.push_back(e);    };
+		const auto OnWindowMouseMovedRaw       = [this](const Event::MouseMovedRaw& e)       { m_mouseMovedRawRun.push_back(e); };
 		
 		m_window->HandleEvents(
 			OnWindowClosed,
@@ -45,6 +47,24 @@ namespace Elos
 			OnWindowMouseMoved,
 			OnWindowMouseMovedRaw
 		);
+
+		FlushMouseMoves();
+	}
+
+	void AppBase::FlushMouseMoves()
+	{
+		// Vectors keep their capacity, so steady-state bursts don't allocate
+		if (!m_mouseMovedRun.empty())
+		{
+			m_windowEventSignals.OnMouseMoved.EmitRange(m_mouseMovedRun);
+			m_mouseMovedRun.clear();
+		}
+
+		if (!m_mouseMovedRawRun.empty())
+		{
+			m_windowEventSignals.OnMouseMovedRaw.EmitRange(m_mouseMovedRawRun);
+			m_mouseMovedRawRun.clear();
+		}
 	}
 
 	AppBase::~AppBase()
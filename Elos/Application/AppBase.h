@@ -14,7 +14,7 @@ namespace Elos
 		void ProcessWindowEvents();
 
 		template <typename EventType>
-		void SetUpConnection(WindowEventConnections& connections, const std::function<void(EventType)>& func)
+		void SetUpConnection(WindowEventConnections& connections, const typename Signal<EventType>::SlotFunction& func)
 		{
 			static_assert(false, "AppBase::SetUpConnection not specialized for non-event types");
 		}
@@ -26,9 +26,18 @@ namespace Elos
 		void InitializeWindow();
 		virtual void GetWindowCreateInfo(WindowCreateInfo& outCreateInfo);
 
+	private:
+		// Emits the pending runs of mouse moves and raw mouse moves with Signal::EmitRange
+		void FlushMouseMoves();
+
 	protected:
 		std::unique_ptr<Window> m_window;
 		WindowEventSignals m_windowEventSignals{};
+
+	private:
+		// Mouse moves are gathered here during ProcessWindowEvents until another event type or the end of the pass
+		std::vector<Event::MouseMoved>    m_mouseMovedRun;
+		std::vector<Event::MouseMovedRaw> m_mouseMovedRawRun;
 	};
 
 	// Macro to set up window event connections template specializations
@@ -36,7 +45,7 @@ namespace Elos
 	template<>                                                                        \
 	inline void AppBase::SetUpConnection<const Event::EventName&>(                    \
 		WindowEventConnections& connections,                                          \
-		const std::function<void(const Event::EventName&)>& func)                     \
+		const Signal<const Event::EventName&>::SlotFunction& func)                    \
 	{                                                                                 \
 		connections.On##EventName = m_windowEventSignals.On##EventName.Connect(func); \
 	}
@@ -0,0 +1,59 @@
+#pragma once
+#include <Elos/Common/FunctionMacros.h>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Elos
+{
+	template <typename Signature> class FunctionRef;
+
+	/**
+	 * @brief Non-owning reference to a callable, two pointers wide
+	 *
+	 * For callbacks that are only called during the call they are passed to (e.g. Timer::Tick).
+	 * The referenced callable must outlive the FunctionRef, so never store one past that call.
+	 */
+	template <typename Return, typename... Args>
+	class FunctionRef<Return(Args...)>
+	{
+	public:
+		template <typename Callable>
+			requires (!std::is_same_v<std::remove_cvref_t<Callable>, FunctionRef>
+				&& !std::is_function_v<std::remove_reference_t<Callable>>
+				&& std::is_invocable_r_v<Return, Callable&, Args...>)
+		FunctionRef(Callable&& callable) noexcept
+			: m_object(const_cast<void*>(static_cast<const void*>(std::addressof(callable))))
+			, m_invoke([](void* object, Args&&... args) -> Return
+			{
+				return std::invoke_r<Return>(*static_cast<std::remove_reference_t<Callable>*>(object), std::forward<Args>(args)...);
+			})
+		{
+		}
+
+		// Plain functions are referenced through their address, which outlives everything
+		template <typename Function>
+			requires (std::is_function_v<Function> && std::is_invocable_r_v<Return, Function&, Args...>)
+		FunctionRef(Function& function) noexcept
+			: m_object(reinterpret_cast<void*>(&function))
+			, m_invoke([](void* object, Args&&... args) -> Return
+			{
+				return std::invoke_r<Return>(*reinterpret_cast<Function*>(object), std::forward<Args>(args)...);
+			})
+		{
+		}
+
+		FunctionRef(const FunctionRef&) noexcept = default;
+		FunctionRef& operator=(const FunctionRef&) noexcept = default;
+
+		Return operator()(Args... args) const
+		{
+			return m_invoke(m_object, std::forward<Args>(args)...);
+		}
+
+	private:
+		void*  m_object;
+		Return (*m_invoke)(void*, Args&&...);
+	};
+}
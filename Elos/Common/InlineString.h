@@ -0,0 +1,79 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/StringTypes.h>
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace Elos
+{
+	/**
+	 * @brief Move-only, immutable string that keeps up to Capacity characters inside the object
+	 *
+	 * Meant for short text handed between threads, such as window titles. Text that fits is copied
+	 * into the inline buffer without allocating; longer text falls back to a single heap block so
+	 * nothing is ever truncated. The text is not null-terminated, use View.
+	 */
+	template <u64 Capacity>
+	class InlineString
+	{
+	public:
+		InlineString() = default;
+		explicit InlineString(StringView text) { Assign(text); }
+
+		InlineString(const InlineString&) = delete;
+		InlineString& operator=(const InlineString&) = delete;
+
+		InlineString(InlineString&& other) noexcept { MoveFrom(other); }
+
+		InlineString& operator=(InlineString&& other) noexcept
+		{
+			if (this != &other)
+			{
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		NODISCARD StringView View() const noexcept { return { Data(), m_size }; }
+		NODISCARD const char* Data() const noexcept { return m_heap ? m_heap.get() : m_inline; }
+		NODISCARD u64 Size() const noexcept { return m_size; }
+		NODISCARD bool Empty() const noexcept { return m_size == 0; }
+
+		// False once the text outgrew the inline buffer
+		NODISCARD bool IsInline() const noexcept { return !m_heap; }
+
+		NODISCARD static constexpr u64 GetCapacity() noexcept { return Capacity; }
+
+		operator StringView() const noexcept { return View(); }
+
+	private:
+		void Assign(StringView text)
+		{
+			char* destination = m_inline;
+			if (text.size() > Capacity)
+			{
+				m_heap = std::make_unique_for_overwrite<char[]>(text.size());
+				destination = m_heap.get();
+			}
+			std::copy(text.begin(), text.end(), destination);
+			m_size = text.size();
+		}
+
+		void MoveFrom(InlineString& other) noexcept
+		{
+			m_heap = std::move(other.m_heap);
+			if (!m_heap)
+			{
+				std::copy_n(other.m_inline, other.m_size, m_inline);
+			}
+			m_size = std::exchange(other.m_size, 0);
+		}
+
+	private:
+		std::unique_ptr<char[]> m_heap;  // Only for text longer than Capacity
+		u64                     m_size = 0;
+		char                    m_inline[Capacity];
+	};
+}
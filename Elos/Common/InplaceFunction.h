@@ -0,0 +1,207 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Elos
+{
+	template <typename Signature, u64 Capacity = 32> class InplaceFunction;
+
+	namespace Internal
+	{
+		template <typename T>
+		inline constexpr bool IsInplaceFunction = false;
+
+		template <typename Signature, u64 Capacity>
+		inline constexpr bool IsInplaceFunction<InplaceFunction<Signature, Capacity>> = true;
+
+		// Per-callable-type operations, shared by every capacity of the same signature
+		template <typename Return, typename... Args>
+		struct InplaceFunctionOps
+		{
+			Return (*Invoke)(void* storage, Args&&... args);
+			void   (*Copy)(void* destination, const void* source);
+			void   (*Move)(void* destination, void* source) noexcept;  // Also destroys the source
+			void   (*Destroy)(void* storage) noexcept;
+
+			template <typename Stored>
+			static constexpr InplaceFunctionOps For
+			{
+				.Invoke = [](void* storage, Args&&... args) -> Return
+				{
+					return std::invoke_r<Return>(*static_cast<Stored*>(storage), std::forward<Args>(args)...);
+				},
+				.Copy = [](void* destination, const void* source)
+				{
+					new (destination) Stored(*static_cast<const Stored*>(source));
+				},
+				.Move = [](void* destination, void* source) noexcept
+				{
+					new (destination) Stored(std::move(*static_cast<Stored*>(source)));
+					static_cast<Stored*>(source)->~Stored();
+				},
+				.Destroy = [](void* storage) noexcept
+				{
+					static_cast<Stored*>(storage)->~Stored();
+				}
+			};
+		};
+	}
+
+	/**
+	 * @brief Copyable type-erased callable stored in a fixed inline buffer
+	 *
+	 * Drop-in for std::function on hot paths: the callable lives in Capacity bytes inside the object and
+	 * there is no heap fallback, so constructing, copying and calling never allocate. Callables that
+	 * don't fit fail to compile instead of silently allocating.
+	 */
+	template <typename Return, typename... Args, u64 Capacity>
+	class InplaceFunction<Return(Args...), Capacity>
+	{
+		template <typename, u64> friend class InplaceFunction;
+
+	public:
+		static constexpr u64 StorageSize = Capacity;
+
+		InplaceFunction() noexcept = default;
+		InplaceFunction(std::nullptr_t) noexcept {}
+
+		template <typename Callable>
+			requires (!Internal::IsInplaceFunction<std::remove_cvref_t<Callable>>
+				&& std::is_invocable_r_v<Return, std::decay_t<Callable>&, Args...>)
+		InplaceFunction(Callable&& callable)
+		{
+			using Stored = std::decay_t<Callable>;
+			static_assert(sizeof(Stored) <= Capacity, "Callable does not fit in the InplaceFunction buffer, raise its capacity");
+			static_assert(alignof(Stored) <= alignof(std::max_align_t), "Over-aligned callables are not supported");
+			static_assert(std::is_copy_constructible_v<Stored>, "InplaceFunction requires a copyable callable");
+
+			if constexpr (std::is_pointer_v<Stored> || std::is_member_pointer_v<Stored>)
+			{
+				if (callable == nullptr)
+				{
+					return;
+				}
+			}
+
+			new (m_storage) Stored(std::forward<Callable>(callable));
+			m_ops    = &Ops::template For<Stored>;
+			m_invoke = m_ops->Invoke;
+		}
+
+		// A smaller InplaceFunction fits in a larger one
+		template <u64 OtherCapacity>
+			requires (OtherCapacity < Capacity)
+		InplaceFunction(const InplaceFunction<Return(Args...), OtherCapacity>& other)
+			: m_ops(other.m_ops)
+			, m_invoke(other.m_invoke)
+		{
+			if (m_ops)
+			{
+				m_ops->Copy(m_storage, other.m_storage);
+			}
+		}
+
+		InplaceFunction(const InplaceFunction& other)
+			: m_ops(other.m_ops)
+			, m_invoke(other.m_invoke)
+		{
+			if (m_ops)
+			{
+				m_ops->Copy(m_storage, other.m_storage);
+			}
+		}
+
+		// Leaves other empty
+		InplaceFunction(InplaceFunction&& other) noexcept
+			: m_ops(other.m_ops)
+			, m_invoke(other.m_invoke)
+		{
+			if (m_ops)
+			{
+				m_ops->Move(m_storage, other.m_storage);
+				other.m_ops = nullptr;
+			}
+		}
+
+		~InplaceFunction()
+		{
+			Reset();
+		}
+
+		InplaceFunction& operator=(const InplaceFunction& other)
+		{
+			if (this != &other)
+			{
+				Reset();
+				if (other.m_ops)
+				{
+					other.m_ops->Copy(m_storage, other.m_storage);
+					m_ops    = other.m_ops;
+					m_invoke = other.m_invoke;
+				}
+			}
+			return *this;
+		}
+
+		InplaceFunction& operator=(InplaceFunction&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Reset();
+				if (other.m_ops)
+				{
+					other.m_ops->Move(m_storage, other.m_storage);
+					m_ops    = std::exchange(other.m_ops, nullptr);
+					m_invoke = other.m_invoke;
+				}
+			}
+			return *this;
+		}
+
+		InplaceFunction& operator=(std::nullptr_t) noexcept
+		{
+			Reset();
+			return *this;
+		}
+
+		template <typename Callable>
+			requires (!Internal::IsInplaceFunction<std::remove_cvref_t<Callable>>
+				&& std::is_invocable_r_v<Return, std::decay_t<Callable>&, Args...>)
+		InplaceFunction& operator=(Callable&& callable)
+		{
+			return *this = InplaceFunction(std::forward<Callable>(callable));
+		}
+
+		// Same contract as std::function: const call, the stored callable is invoked as non-const
+		Return operator()(Args... args) const
+		{
+			return m_invoke(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+		}
+
+		NODISCARD explicit operator bool() const noexcept { return m_ops != nullptr; }
+		NODISCARD friend bool operator==(const InplaceFunction& function, std::nullptr_t) noexcept { return !function; }
+
+	private:
+		using Ops     = Internal::InplaceFunctionOps<Return, Args...>;
+		using Invoker = Return (*)(void*, Args&&...);
+
+		void Reset() noexcept
+		{
+			if (m_ops)
+			{
+				m_ops->Destroy(m_storage);
+				m_ops = nullptr;
+			}
+		}
+
+	private:
+		const Ops*                          m_ops    = nullptr;
+		Invoker                             m_invoke = nullptr;  // Copy of m_ops->Invoke, saves an indirection per call
+		alignas(std::max_align_t) std::byte m_storage[Capacity];
+	};
+}
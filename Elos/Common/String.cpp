@@ -5,7 +5,7 @@
 
 namespace Elos
 {
-	WString StringToWString(const String& string)
+	WString StringToWString(StringView string)
 	{
 		i32 cch = ::MultiByteToWideChar(CP_ACP, 0, string.data(), (i32)string.size(), nullptr, 0);
 
@@ -0,0 +1,11 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+namespace Elos
+{
+	using String      = std::string;
+	using StringView  = std::string_view;
+	using WString     = std::wstring;
+	using WStringView = std::wstring_view;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <Elos/Common/FunctionMacros.h>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Elos
+{
+	/**
+	 * @brief Implicit binary heap over a vector, the std::priority_queue layout with a move-out Pop
+	 *
+	 * Same ordering convention as std::priority_queue: Top() is an item no other item compares
+	 * greater than. One contiguous allocation that is reused once it has grown.
+	 */
+	template <typename T, typename Compare = std::less<T>>
+	class BinaryHeap
+	{
+	public:
+		BinaryHeap() = default;
+		explicit BinaryHeap(const Compare& compare) : m_compare(compare) {}
+
+		template <typename... ConstructArgs>
+		void Emplace(ConstructArgs&&... args)
+		{
+			m_items.emplace_back(std::forward<ConstructArgs>(args)...);
+			std::push_heap(m_items.begin(), m_items.end(), m_compare);
+		}
+
+		void Push(T&& item) { Emplace(std::move(item)); }
+
+		NODISCARD const T& Top() const { return m_items.front(); }
+
+		T Pop()
+		{
+			std::pop_heap(m_items.begin(), m_items.end(), m_compare);
+			T item = std::move(m_items.back());
+			m_items.pop_back();
+			return item;
+		}
+
+		NODISCARD bool Empty() const noexcept { return m_items.empty(); }
+		NODISCARD size_t Size() const noexcept { return m_items.size(); }
+		void Clear() noexcept { m_items.clear(); }
+		void Reserve(size_t capacity) { m_items.reserve(capacity); }
+
+	private:
+		std::vector<T> m_items;
+		Compare        m_compare;
+	};
+}
@@ -0,0 +1,227 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace Elos
+{
+	/**
+	 * @brief Bounded lock-free queue for any number of producers and consumers
+	 *
+	 * Vyukov's array queue: every cell carries a sequence number telling producers and consumers
+	 * whose turn it is, so each side claims a cell with a single CAS on its own position counter
+	 * and never touches a lock. Mirrors the ThreadSafeQueue surface; Push and WaitAndPop block
+	 * (spin briefly, then park on std::atomic::wait) while the queue is full/empty.
+	 */
+	template <typename T, u64 Capacity>
+	class MpmcQueue
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MpmcQueue capacity must be a power of two");
+
+	public:
+		MpmcQueue()
+			: m_cells(std::make_unique<Cell[]>(Capacity))
+		{
+			for (u64 i = 0; i < Capacity; ++i)
+			{
+				m_cells[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		~MpmcQueue()
+		{
+			Clear();
+		}
+
+		MpmcQueue(const MpmcQueue&) = delete;
+		MpmcQueue& operator=(const MpmcQueue&) = delete;
+		MpmcQueue(MpmcQueue&&) = delete;
+		MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+		// Blocks while the queue is full
+		void Push(const T& item) { Emplace(item); }
+		void Push(T&& item) { Emplace(std::move(item)); }
+
+		template <typename... ConstructArgs>
+		void Emplace(ConstructArgs&&... args)
+		{
+			BlockUntil(m_popSignal, [&]() { return TryEmplace(std::forward<ConstructArgs>(args)...); });
+		}
+
+		NODISCARD bool TryPush(const T& item) { return TryEmplace(item); }
+		NODISCARD bool TryPush(T&& item) { return TryEmplace(std::move(item)); }
+
+		template <typename... ConstructArgs>
+		NODISCARD bool TryEmplace(ConstructArgs&&... args)
+		{
+			u64 position = m_enqueue.Position.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& cell = m_cells[position & (Capacity - 1)];
+				const u64 sequence = cell.Sequence.load(std::memory_order_acquire);
+				const i64 difference = static_cast<i64>(sequence) - static_cast<i64>(position);
+
+				if (difference == 0)
+				{
+					if (m_enqueue.Position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						std::construct_at(cell.Item(), std::forward<ConstructArgs>(args)...);
+						cell.Sequence.store(position + 1, std::memory_order_release);
+						Wake(m_pushSignal);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;  // Full: the cell still holds the item from one lap ago
+				}
+				else
+				{
+					position = m_enqueue.Position.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		NODISCARD std::optional<T> TryPop()
+		{
+			std::optional<T> item;
+			(void)TryPop(item);
+			return item;
+		}
+
+		template <typename Out>
+		NODISCARD bool TryPop(Out& out)
+		{
+			u64 position = m_dequeue.Position.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& cell = m_cells[position & (Capacity - 1)];
+				const u64 sequence = cell.Sequence.load(std::memory_order_acquire);
+				const i64 difference = static_cast<i64>(sequence) - static_cast<i64>(position + 1);
+
+				if (difference == 0)
+				{
+					if (m_dequeue.Position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						T* item = cell.Item();
+						out = std::move(*item);
+						std::destroy_at(item);
+						cell.Sequence.store(position + Capacity, std::memory_order_release);
+						Wake(m_popSignal);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;  // Empty: nothing was published into this cell yet
+				}
+				else
+				{
+					position = m_dequeue.Position.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// Blocks while the queue is empty
+		T WaitAndPop()
+		{
+			std::optional<T> item;
+			BlockUntil(m_pushSignal, [&]() { return TryPop(item); });
+			return std::move(*item);
+		}
+
+		// Approximate while other threads are pushing or popping
+		NODISCARD u64 Size() const noexcept
+		{
+			const u64 dequeue = m_dequeue.Position.load(std::memory_order_acquire);
+			const u64 enqueue = m_enqueue.Position.load(std::memory_order_acquire);
+			return enqueue > dequeue ? enqueue - dequeue : 0;
+		}
+
+		NODISCARD bool Empty() const noexcept { return Size() == 0; }
+		NODISCARD static constexpr u64 GetCapacity() noexcept { return Capacity; }
+
+		void Clear()
+		{
+			std::optional<T> item;
+			while (TryPop(item))
+			{
+			}
+		}
+
+	private:
+		struct Cell
+		{
+			std::atomic<u64>     Sequence;
+			alignas(T) std::byte Bytes[sizeof(T)];
+
+			NODISCARD T* Item() noexcept { return std::launder(reinterpret_cast<T*>(Bytes)); }
+		};
+
+		struct alignas(64) PositionLine
+		{
+			std::atomic<u64> Position{ 0 };
+		};
+
+		// Lets blocked threads park until the other side makes progress. The low bit of State says
+		// somebody parked on the current epoch, the rest counts epochs. Wakers only pay for a notify when
+		// that bit is set and clear it by moving to the next epoch, so a burst of pushes towards a
+		// descheduled waiter costs one wake rather than one per item. A waiter that arms again sets the
+		// bit on the new epoch, so no notify is ever skipped for it
+		struct alignas(64) ParkSignal
+		{
+			std::atomic<u32> State{ 0 };
+		};
+
+		static constexpr u32 SpinCount = 64;
+		static constexpr u32 ArmedBit  = 1;
+
+		static void Wake(ParkSignal& signal) noexcept
+		{
+			// Pairs with the fence in BlockUntil: either the waiter sees our item or we see its bit
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			u32 state = signal.State.load(std::memory_order_relaxed);
+			if ((state & ArmedBit) != 0
+				&& signal.State.compare_exchange_strong(state, (state & ~ArmedBit) + 2, std::memory_order_release, std::memory_order_relaxed))
+			{
+				signal.State.notify_all();
+			}
+			// A failed exchange means another waker already moved to the next epoch, releasing every waiter
+		}
+
+		template <typename Attempt>
+		static void BlockUntil(ParkSignal& signal, Attempt&& attempt)
+		{
+			for (u32 spin = 0; spin < SpinCount; ++spin)
+			{
+				if (attempt())
+				{
+					return;
+				}
+			}
+
+			for (;;)
+			{
+				const u32 armed = signal.State.fetch_or(ArmedBit, std::memory_order_acq_rel) | ArmedBit;
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (attempt())
+				{
+					return;
+				}
+				signal.State.wait(armed, std::memory_order_acquire);
+			}
+		}
+
+	private:
+		std::unique_ptr<Cell[]> m_cells;
+		PositionLine            m_enqueue;
+		PositionLine            m_dequeue;
+		ParkSignal              m_pushSignal;  // Bumped when an item is pushed, consumers park on it
+		ParkSignal              m_popSignal;   // Bumped when an item is popped, producers park on it
+	};
+}
@@ -0,0 +1,141 @@
+#pragma once
+#include <Elos/Common/FunctionMacros.h>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Elos
+{
+	/**
+	 * @brief Pairing heap with pooled nodes, a drop-in alternative to BinaryHeap
+	 *
+	 * Push is O(1) (one comparison against the root), Pop is amortized O(log n) via the standard
+	 * two-pass merge of the root's children. Nodes live in a deque and are recycled through a free
+	 * list, so a heap that has reached its working size no longer allocates.
+	 */
+	template <typename T, typename Compare = std::less<T>>
+	class PairingHeap
+	{
+	public:
+		PairingHeap() = default;
+		explicit PairingHeap(const Compare& compare) : m_compare(compare) {}
+
+		PairingHeap(const PairingHeap&) = delete;
+		PairingHeap& operator=(const PairingHeap&) = delete;
+		PairingHeap(PairingHeap&&) = default;
+		PairingHeap& operator=(PairingHeap&&) = default;
+
+		template <typename... ConstructArgs>
+		void Emplace(ConstructArgs&&... args)
+		{
+			Node* node = AcquireNode();
+			node->Value.emplace(std::forward<ConstructArgs>(args)...);
+			m_root = m_root ? Meld(m_root, node) : node;
+			++m_size;
+		}
+
+		void Push(T&& item) { Emplace(std::move(item)); }
+
+		NODISCARD const T& Top() const { return *m_root->Value; }
+
+		T Pop()
+		{
+			Node* root = m_root;
+			T item = std::move(*root->Value);
+			m_root = MergePairs(root->Child);
+			ReleaseNode(root);
+			--m_size;
+			return item;
+		}
+
+		NODISCARD bool Empty() const noexcept { return m_size == 0; }
+		NODISCARD size_t Size() const noexcept { return m_size; }
+
+		void Clear() noexcept
+		{
+			m_nodes.clear();
+			m_free = nullptr;
+			m_root = nullptr;
+			m_size = 0;
+		}
+
+	private:
+		struct Node
+		{
+			std::optional<T> Value;
+			Node*            Child   = nullptr;
+			Node*            Sibling = nullptr;  // Next sibling, doubles as the free list link
+		};
+
+		// The root with the higher priority adopts the other as its first child
+		Node* Meld(Node* a, Node* b)
+		{
+			if (m_compare(*a->Value, *b->Value))
+			{
+				std::swap(a, b);
+			}
+			b->Sibling = a->Child;
+			a->Child = b;
+			return a;
+		}
+
+		// Two-pass merge: meld siblings pairwise left to right, then fold the pairs right to left
+		Node* MergePairs(Node* first)
+		{
+			m_pairs.clear();
+			while (first)
+			{
+				Node* a = first;
+				Node* b = a->Sibling;
+				if (!b)
+				{
+					a->Sibling = nullptr;
+					m_pairs.push_back(a);
+					break;
+				}
+
+				first = b->Sibling;
+				a->Sibling = nullptr;
+				b->Sibling = nullptr;
+				m_pairs.push_back(Meld(a, b));
+			}
+
+			Node* root = nullptr;
+			for (auto it = m_pairs.rbegin(); it != m_pairs.rend(); ++it)
+			{
+				root = root ? Meld(*it, root) : *it;
+			}
+			return root;
+		}
+
+		Node* AcquireNode()
+		{
+			if (m_free)
+			{
+				Node* node = m_free;
+				m_free = node->Sibling;
+				node->Sibling = nullptr;
+				return node;
+			}
+			return &m_nodes.emplace_back();
+		}
+
+		void ReleaseNode(Node* node)
+		{
+			node->Value.reset();
+			node->Child = nullptr;
+			node->Sibling = m_free;
+			m_free = node;
+		}
+
+	private:
+		std::deque<Node>   m_nodes;  // Stable addresses, never shrinks until Clear
+		std::vector<Node*> m_pairs;  // Scratch for MergePairs
+		Node*              m_free = nullptr;
+		Node*              m_root = nullptr;
+		size_t             m_size = 0;
+		Compare            m_compare;
+	};
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include <stdexcept>
+
+namespace Elos
+{
+	// Thrown by a blocking pop once its queue is closed and no item is left for it
+	class QueueClosedError : public std::runtime_error
+	{
+	public:
+		QueueClosedError() : std::runtime_error("Queue was closed while waiting for an item") {}
+	};
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace Elos
+{
+	/**
+	 * @brief Wakeup channel shared by several queues and the one consumer waiting on all of them
+	 *
+	 * Producers call Notify after publishing an item; it costs one atomic load unless a consumer is
+	 * waiting. A consumer calls Arm to snapshot the epoch, rechecks its queues, then waits for the
+	 * epoch to move. Anything published after Arm either shows up in the recheck or bumps the epoch.
+	 */
+	class QueueNotifier
+	{
+	public:
+		QueueNotifier() = default;
+
+		QueueNotifier(const QueueNotifier&) = delete;
+		QueueNotifier& operator=(const QueueNotifier&) = delete;
+		QueueNotifier(QueueNotifier&&) = delete;
+		QueueNotifier& operator=(QueueNotifier&&) = delete;
+
+		void Notify()
+		{
+			if (m_waiters.load(std::memory_order_seq_cst) == 0)
+			{
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				++m_epoch;
+			}
+			m_condVar.notify_all();
+		}
+
+		// Registers the caller as a waiter, returns the epoch to pass to Wait
+		NODISCARD u64 Arm()
+		{
+			m_waiters.fetch_add(1, std::memory_order_seq_cst);
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_epoch;
+		}
+
+		// Blocks until the epoch moves past armedEpoch or the deadline passes, then disarms.
+		// Returns false on timeout
+		template <typename Clock, typename Duration>
+		bool WaitUntil(u64 armedEpoch, const std::chrono::time_point<Clock, Duration>& deadline)
+		{
+			bool notified = false;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				notified = m_condVar.wait_until(lock, deadline, [&] { return m_epoch != armedEpoch; });
+			}
+			Disarm();
+			return notified;
+		}
+
+		void Wait(u64 armedEpoch)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condVar.wait(lock, [&] { return m_epoch != armedEpoch; });
+			}
+			Disarm();
+		}
+
+		// For a waiter that found work in its recheck and won't wait after all
+		void Disarm()
+		{
+			m_waiters.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		u64                     m_epoch = 0;
+		std::atomic<u32>        m_waiters{ 0 };
+	};
+}
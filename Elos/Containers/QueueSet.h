@@ -0,0 +1,182 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Containers/QueueClosedError.h>
+#include <Elos/Containers/QueueNotifier.h>
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace Elos
+{
+	/**
+	 * @brief Lets one consumer block until any of several ThreadSafeQueues has items
+	 *
+	 * Every queue added to the set signals the set's single QueueNotifier, so waiting costs one
+	 * condition variable however many queues are watched. WaitAny returns the index Add handed out
+	 * for a non-empty queue; scans start after the last queue reported so a busy queue can't starve
+	 * the others. A queue that is closed and drained is never reported again, and once every queue
+	 * is, the waits throw QueueClosedError, so closing the queues releases the consumer at shutdown.
+	 *
+	 * Queues must outlive the set, which detaches from them when destroyed, and a queue can belong
+	 * to only one set at a time. Queues signal the set under their own lock, so the consumer may
+	 * destroy the set as soon as a wait has thrown, while a producer is still returning from Close.
+	 */
+	class QueueSet
+	{
+	public:
+		QueueSet() = default;
+
+		~QueueSet()
+		{
+			for (const Entry& entry : m_entries)
+			{
+				entry.Detach(entry.Queue);
+			}
+		}
+
+		QueueSet(const QueueSet&) = delete;
+		QueueSet& operator=(const QueueSet&) = delete;
+		QueueSet(QueueSet&&) = delete;
+		QueueSet& operator=(QueueSet&&) = delete;
+
+		// Not thread safe with a concurrent WaitAny. Returns the index WaitAny reports for this queue
+		template <typename T>
+		size_t Add(ThreadSafeQueue<T>& queue)
+		{
+			queue.SetNotifier(&m_notifier);
+			m_entries.push_back(Entry
+			{
+				.Queue    = &queue,
+				.GetState = [](void* q)
+				{
+					// Closed is read first: a queue that was empty after closing stays empty
+					const auto* typed = static_cast<ThreadSafeQueue<T>*>(q);
+					const bool closed = typed->IsClosed();
+					return !typed->Empty() ? QueueState::Items : closed ? QueueState::Drained : QueueState::Empty;
+				},
+				.Detach   = [](void* q) { static_cast<ThreadSafeQueue<T>*>(q)->SetNotifier(nullptr); },
+			});
+			return m_entries.size() - 1;
+		}
+
+		NODISCARD size_t Size() const noexcept { return m_entries.size(); }
+
+		// Index of a non-empty queue, or nullopt if they are all empty
+		NODISCARD std::optional<size_t> Poll()
+		{
+			return Scan().Index;
+		}
+
+		// Blocks until one of the queues has items. Throws QueueClosedError once every queue is closed and drained
+		size_t WaitAny()
+		{
+			for (;;)
+			{
+				if (const std::optional<size_t> index = PollOrThrow())
+				{
+					return *index;
+				}
+
+				const u64 epoch = m_notifier.Arm();
+				if (const std::optional<size_t> index = PollOrThrow(true))
+				{
+					m_notifier.Disarm();
+					return *index;
+				}
+				m_notifier.Wait(epoch);
+			}
+		}
+
+		template <typename Rep, typename Period>
+		NODISCARD std::optional<size_t> WaitAnyFor(const std::chrono::duration<Rep, Period>& timeout)
+		{
+			return WaitAnyUntil(std::chrono::steady_clock::now() + timeout);
+		}
+
+		// Index of a non-empty queue, or nullopt if the deadline passed first. Throws like WaitAny
+		template <typename Clock, typename Duration>
+		NODISCARD std::optional<size_t> WaitAnyUntil(const std::chrono::time_point<Clock, Duration>& deadline)
+		{
+			for (;;)
+			{
+				if (const std::optional<size_t> index = PollOrThrow())
+				{
+					return index;
+				}
+
+				const u64 epoch = m_notifier.Arm();
+				if (const std::optional<size_t> index = PollOrThrow(true))
+				{
+					m_notifier.Disarm();
+					return index;
+				}
+
+				if (!m_notifier.WaitUntil(epoch, deadline))
+				{
+					return PollOrThrow();
+				}
+			}
+		}
+
+	private:
+		enum class QueueState
+		{
+			Empty,
+			Items,
+			Drained,  // Closed and empty, nothing will arrive any more
+		};
+
+		struct Entry
+		{
+			void*      Queue;
+			QueueState (*GetState)(void* queue);
+			void       (*Detach)(void* queue);
+		};
+
+		struct ScanResult
+		{
+			std::optional<size_t> Index;
+			bool                  AllDrained = false;
+		};
+
+		ScanResult Scan()
+		{
+			const size_t count = m_entries.size();
+			bool allDrained = count != 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				const size_t index = (m_next + i) % count;
+				const QueueState state = m_entries[index].GetState(m_entries[index].Queue);
+				if (state == QueueState::Items)
+				{
+					m_next = index + 1;
+					return { index, false };
+				}
+				allDrained = allDrained && state == QueueState::Drained;
+			}
+			return { std::nullopt, allDrained };
+		}
+
+		// Disarms first if armed, so a throw never leaves the notifier armed
+		std::optional<size_t> PollOrThrow(bool armed = false)
+		{
+			const ScanResult result = Scan();
+			if (!result.Index && result.AllDrained)
+			{
+				if (armed)
+				{
+					m_notifier.Disarm();
+				}
+				throw QueueClosedError();
+			}
+			return result.Index;
+		}
+
+	private:
+		QueueNotifier      m_notifier;
+		std::vector<Entry> m_entries;
+		size_t             m_next = 0;  // Where the next scan starts
+	};
+}
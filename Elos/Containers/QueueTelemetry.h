@@ -0,0 +1,198 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/InplaceFunction.h>
+#include <Elos/Utils/Timer.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+
+namespace Elos
+{
+	struct QueueStats
+	{
+		// Bucket i counts items that waited [2^(i-1), 2^i) nanoseconds, the last bucket also takes everything slower
+		static constexpr u32 BucketCount = 32;
+
+		u64 Depth     = 0;  // Items queued at the last push or pop
+		u64 HighWater = 0;
+		u64 Pushed    = 0;  // Totals since telemetry was enabled
+		u64 Popped    = 0;
+
+		// Over the window since the previous snapshot callback, or since telemetry was enabled
+		f64 WindowSeconds = 0.0;
+		f64 PushRate      = 0.0;  // Items per second
+		f64 PopRate       = 0.0;
+
+		// Enqueue to dequeue latency of every popped item
+		f64                          TotalLatencyMs = 0.0;
+		f64                          MaxLatencyMs   = 0.0;
+		std::array<u64, BucketCount> LatencyHistogram{};
+
+		NODISCARD f64 AverageLatencyMs() const noexcept { return Popped ? TotalLatencyMs / static_cast<f64>(Popped) : 0.0; }
+
+		// Upper bound of the bucket holding the given fraction of latencies, e.g. 0.99 for p99
+		NODISCARD u64 LatencyPercentileNs(f64 fraction) const noexcept
+		{
+			const u64 target = static_cast<u64>(fraction * static_cast<f64>(Popped));
+			u64 seen = 0;
+			for (u32 bucket = 0; bucket < BucketCount; ++bucket)
+			{
+				seen += LatencyHistogram[bucket];
+				if (seen > target || seen == Popped)
+				{
+					return BucketLimitNs(bucket);
+				}
+			}
+			return BucketLimitNs(BucketCount - 1);
+		}
+
+		// Exclusive upper bound of a bucket, in nanoseconds
+		NODISCARD static constexpr u64 BucketLimitNs(u32 bucket) noexcept { return u64{ 1 } << bucket; }
+	};
+
+	/**
+	 * @brief Depth, throughput and enqueue-to-dequeue latency of one queue
+	 *
+	 * The owning queue records pushes and pops while holding its own lock, passing the depth it saw
+	 * and the timestamp it stored with the item on push. Stats can be read from any thread. The
+	 * snapshot callback runs on whichever thread pushes or pops once the interval has elapsed,
+	 * after the queue's lock is released, so it may query the queue.
+	 */
+	class QueueTelemetry
+	{
+	public:
+		using SnapshotCallback = InplaceFunction<void(const QueueStats&)>;
+
+		QueueTelemetry()
+			: m_windowStart(Timer::Now())
+		{
+		}
+
+		QueueTelemetry(const QueueTelemetry&) = delete;
+		QueueTelemetry& operator=(const QueueTelemetry&) = delete;
+
+		void RecordPush(u64 depth, Timer::TimePoint now)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_stats.Pushed;
+			m_stats.Depth     = depth;
+			m_stats.HighWater = std::max(m_stats.HighWater, depth);
+			CheckSnapshotDue(now);
+		}
+
+		void RecordPop(u64 depth, Timer::TimePoint pushedAt, Timer::TimePoint now)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			RecordLatency(pushedAt, now);
+			m_stats.Depth = depth;
+			CheckSnapshotDue(now);
+		}
+
+		// Many items leaving at once, as DrainTo does; depth is what's left afterwards
+		template <typename PushTimes>
+		void RecordPops(u64 depth, PushTimes&& pushedAt, Timer::TimePoint now)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (const Timer::TimePoint time : pushedAt)
+			{
+				RecordLatency(time, now);
+			}
+			m_stats.Depth = depth;
+			CheckSnapshotDue(now);
+		}
+
+		void RecordDepth(u64 depth)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stats.Depth = depth;
+		}
+
+		NODISCARD QueueStats GetStats() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return WithRates(Timer::Now());
+		}
+
+		// Calls callback with a snapshot roughly every interval while the queue is in use. Each
+		// snapshot starts a new rate window
+		void SetSnapshotCallback(std::chrono::nanoseconds interval, SnapshotCallback callback)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_interval = interval;
+			m_callback = std::move(callback);
+		}
+
+		// Called by the queue once its lock is released
+		void PublishIfDue()
+		{
+			if (!m_snapshotDue.load(std::memory_order_relaxed) || !m_snapshotDue.exchange(false, std::memory_order_acquire))
+			{
+				return;
+			}
+
+			QueueStats stats;
+			SnapshotCallback callback;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				const Timer::TimePoint now = Timer::Now();
+				stats = WithRates(now);
+				callback = m_callback;
+
+				m_windowStart  = now;
+				m_windowPushed = m_stats.Pushed;
+				m_windowPopped = m_stats.Popped;
+			}
+
+			if (callback)
+			{
+				callback(stats);
+			}
+		}
+
+	private:
+		void RecordLatency(Timer::TimePoint pushedAt, Timer::TimePoint now)
+		{
+			const auto ns = static_cast<u64>(std::max<i64>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(now - pushedAt).count()));
+			const f64 ms = static_cast<f64>(ns) / 1'000'000.0;
+
+			++m_stats.Popped;
+			m_stats.TotalLatencyMs += ms;
+			m_stats.MaxLatencyMs    = std::max(m_stats.MaxLatencyMs, ms);
+			++m_stats.LatencyHistogram[std::min<u64>(std::bit_width(ns), QueueStats::BucketCount - 1)];
+		}
+
+		void CheckSnapshotDue(Timer::TimePoint now)
+		{
+			if (m_callback && now - m_windowStart >= m_interval)
+			{
+				m_snapshotDue.store(true, std::memory_order_release);
+			}
+		}
+
+		NODISCARD QueueStats WithRates(Timer::TimePoint now) const
+		{
+			QueueStats stats = m_stats;
+			stats.WindowSeconds = Timer::DurationInSeconds(m_windowStart, now);
+			if (stats.WindowSeconds > 0.0)
+			{
+				stats.PushRate = static_cast<f64>(m_stats.Pushed - m_windowPushed) / stats.WindowSeconds;
+				stats.PopRate  = static_cast<f64>(m_stats.Popped - m_windowPopped) / stats.WindowSeconds;
+			}
+			return stats;
+		}
+
+	private:
+		mutable std::mutex       m_mutex;
+		QueueStats               m_stats;
+		Timer::TimePoint         m_windowStart;
+		u64                      m_windowPushed = 0;
+		u64                      m_windowPopped = 0;
+		std::chrono::nanoseconds m_interval{ 0 };
+		SnapshotCallback         m_callback;
+		std::atomic<bool>        m_snapshotDue{ false };
+	};
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+#endif
+
+namespace Elos
+{
+	// How a blocking pop waits for an item: poll with a pause instruction, then poll with a yield,
+	// then park. The default parks straight away, which suits consumers that are idle most of the time
+	struct QueueWaitStrategy
+	{
+		u32 SpinCount  = 0;
+		u32 YieldCount = 0;
+
+		// Sub-millisecond handoffs between two busy threads, e.g. command round trips
+		static constexpr QueueWaitStrategy LowLatency() { return QueueWaitStrategy{ .SpinCount = 1000, .YieldCount = 16 }; }
+	};
+
+	namespace Internal
+	{
+		// Tells the core we're in a spin-wait loop, so it can save power and yield to its sibling
+		inline void CpuPause() noexcept
+		{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+			_mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+			_mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+			__yield();
+#elif defined(__aarch64__)
+			asm volatile("yield");
+#else
+			std::this_thread::yield();
+#endif
+		}
+
+		// Runs the spin and yield phases of strategy, returns true as soon as ready() does.
+		// Spinning is skipped on a single core, where the other side can't run until we stop
+		template <typename Ready>
+		bool SpinUntil(const QueueWaitStrategy& strategy, Ready&& ready)
+		{
+			static const bool multiCore = std::thread::hardware_concurrency() > 1;
+			const u32 spinCount = multiCore ? strategy.SpinCount : 0;
+			for (u32 i = 0; i < spinCount; ++i)
+			{
+				if (ready())
+				{
+					return true;
+				}
+				CpuPause();
+			}
+
+			for (u32 i = 0; i < strategy.YieldCount; ++i)
+			{
+				if (ready())
+				{
+					return true;
+				}
+				std::this_thread::yield();
+			}
+
+			return ready();
+		}
+	}
+}
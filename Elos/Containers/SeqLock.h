@@ -0,0 +1,101 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace Elos
+{
+	/**
+	 * @brief A value one thread publishes and any thread reads without locking
+	 *
+	 * The writer bumps the sequence to odd, stores the value and bumps it back to even. Readers copy
+	 * the value between two reads of the sequence and retry if it was odd or changed, so a read
+	 * never blocks the writer, never makes a syscall and never sees half of a write; it only
+	 * repeats when a write lands in the middle of it. The value is kept as relaxed atomic words so
+	 * the racing copy is well defined.
+	 */
+	template <typename T>
+	class SeqLock
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "SeqLock values are copied word by word");
+
+	public:
+		SeqLock() noexcept : SeqLock(T{}) {}
+		explicit SeqLock(const T& value) noexcept { Write(value); }
+
+		SeqLock(const SeqLock&) = delete;
+		SeqLock& operator=(const SeqLock&) = delete;
+
+		// Any thread
+		NODISCARD T Load() const noexcept
+		{
+			for (;;)
+			{
+				const u64 before = m_sequence.load(std::memory_order_acquire);
+				if ((before & 1) == 0) LIKELY
+				{
+					T value = Read();
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (m_sequence.load(std::memory_order_relaxed) == before) LIKELY
+					{
+						return value;
+					}
+				}
+			}
+		}
+
+		// Number of Stores so far, e.g. to tell whether anything changed since the last Load
+		NODISCARD u64 GetVersion() const noexcept { return m_sequence.load(std::memory_order_acquire) / 2; }
+
+		// Writer thread only
+		void Store(const T& value) noexcept
+		{
+			const u64 sequence = m_sequence.load(std::memory_order_relaxed);
+			m_sequence.store(sequence + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			Write(value);
+			m_sequence.store(sequence + 2, std::memory_order_release);
+		}
+
+		// Writer thread only. Applies update to the current value and publishes the result
+		template <typename Updater>
+		void Update(Updater&& update)
+		{
+			T value = Read();
+			update(value);
+			Store(value);
+		}
+
+	private:
+		static constexpr size_t WordCount = (sizeof(T) + sizeof(u64) - 1) / sizeof(u64);
+
+		NODISCARD T Read() const noexcept
+		{
+			std::array<u64, WordCount> words;
+			for (size_t i = 0; i < WordCount; ++i)
+			{
+				words[i] = m_words[i].load(std::memory_order_relaxed);
+			}
+			T value;
+			std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+			return value;
+		}
+
+		void Write(const T& value) noexcept
+		{
+			std::array<u64, WordCount> words{};
+			std::memcpy(words.data(), &value, sizeof(T));
+			for (size_t i = 0; i < WordCount; ++i)
+			{
+				m_words[i].store(words[i], std::memory_order_relaxed);
+			}
+		}
+
+	private:
+		alignas(64) std::atomic<u64> m_sequence{ 0 };
+		std::array<std::atomic<u64>, WordCount> m_words;
+	};
+}
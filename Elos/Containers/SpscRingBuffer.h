@@ -0,0 +1,188 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Elos
+{
+	/**
+	 * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread
+	 *
+	 * Head and tail are free-running counters on their own cache lines, masked into a power-of-two
+	 * slot array, and only ever synchronized with acquire/release. Each side also keeps a cached copy
+	 * of the other side's index so it only touches the shared line when the cache says full/empty.
+	 * Batch push/pop publish a whole run of items with a single release store.
+	 */
+	template <typename T, u64 Capacity>
+	class SpscRingBuffer
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscRingBuffer capacity must be a power of two");
+
+	public:
+		SpscRingBuffer() = default;
+
+		~SpscRingBuffer()
+		{
+			const u64 tail = m_producer.Tail.load(std::memory_order_relaxed);
+			for (u64 head = m_consumer.Head.load(std::memory_order_relaxed); head != tail; ++head)
+			{
+				std::destroy_at(SlotAt(head));
+			}
+		}
+
+		SpscRingBuffer(const SpscRingBuffer&) = delete;
+		SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+		SpscRingBuffer(SpscRingBuffer&&) = delete;
+		SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+
+		// Producer side
+
+		NODISCARD bool TryPush(const T& item) { return TryEmplace(item); }
+		NODISCARD bool TryPush(T&& item) { return TryEmplace(std::move(item)); }
+
+		template <typename... ConstructArgs>
+		NODISCARD bool TryEmplace(ConstructArgs&&... args)
+		{
+			const u64 tail = m_producer.Tail.load(std::memory_order_relaxed);
+			if (tail - m_producer.CachedHead == Capacity)
+			{
+				m_producer.CachedHead = m_consumer.Head.load(std::memory_order_acquire);
+				if (tail - m_producer.CachedHead == Capacity)
+				{
+					return false;
+				}
+			}
+
+			std::construct_at(SlotAt(tail), std::forward<ConstructArgs>(args)...);
+			m_producer.Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Copies in as many leading items as fit, returns how many were pushed
+		u64 TryPushBatch(std::span<const T> items)
+		{
+			const u64 tail  = m_producer.Tail.load(std::memory_order_relaxed);
+			u64       count = std::min<u64>(items.size(), Capacity - (tail - m_producer.CachedHead));
+			if (count < items.size())
+			{
+				m_producer.CachedHead = m_consumer.Head.load(std::memory_order_acquire);
+				count = std::min<u64>(items.size(), Capacity - (tail - m_producer.CachedHead));
+			}
+
+			for (u64 i = 0; i < count; ++i)
+			{
+				std::construct_at(SlotAt(tail + i), items[i]);
+			}
+
+			if (count != 0)
+			{
+				m_producer.Tail.store(tail + count, std::memory_order_release);
+			}
+			return count;
+		}
+
+		// Consumer side
+
+		NODISCARD std::optional<T> TryPop()
+		{
+			std::optional<T> item;
+			(void)TryPop(item);
+			return item;
+		}
+
+		// Moves the front item into out, avoiding the optional when the caller has storage to reuse
+		template <typename Out>
+		NODISCARD bool TryPop(Out& out)
+		{
+			const u64 head = m_consumer.Head.load(std::memory_order_relaxed);
+			if (head == m_consumer.CachedTail)
+			{
+				m_consumer.CachedTail = m_producer.Tail.load(std::memory_order_acquire);
+				if (head == m_consumer.CachedTail)
+				{
+					return false;
+				}
+			}
+
+			T* slot = SlotAt(head);
+			out = std::move(*slot);
+			std::destroy_at(slot);
+			m_consumer.Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Moves up to out.size() items into out, returns how many were popped
+		u64 TryPopBatch(std::span<T> out)
+		{
+			const u64 head  = m_consumer.Head.load(std::memory_order_relaxed);
+			u64       count = std::min<u64>(out.size(), m_consumer.CachedTail - head);
+			if (count < out.size())
+			{
+				m_consumer.CachedTail = m_producer.Tail.load(std::memory_order_acquire);
+				count = std::min<u64>(out.size(), m_consumer.CachedTail - head);
+			}
+
+			for (u64 i = 0; i < count; ++i)
+			{
+				T* slot = SlotAt(head + i);
+				out[i] = std::move(*slot);
+				std::destroy_at(slot);
+			}
+
+			if (count != 0)
+			{
+				m_consumer.Head.store(head + count, std::memory_order_release);
+			}
+			return count;
+		}
+
+		// Either side; exact only when the other side is idle
+
+		NODISCARD u64 Size() const noexcept
+		{
+			const u64 head = m_consumer.Head.load(std::memory_order_acquire);
+			const u64 tail = m_producer.Tail.load(std::memory_order_acquire);
+			return tail - head;
+		}
+
+		NODISCARD bool Empty() const noexcept { return Size() == 0; }
+		NODISCARD static constexpr u64 GetCapacity() noexcept { return Capacity; }
+
+	private:
+		NODISCARD T* SlotAt(u64 index) noexcept
+		{
+			return std::launder(reinterpret_cast<T*>(m_slots[index & (Capacity - 1)].Bytes));
+		}
+
+		struct Slot
+		{
+			alignas(T) std::byte Bytes[sizeof(T)];
+		};
+
+		// Written by the producer, read by the consumer
+		struct alignas(64) ProducerLine
+		{
+			std::atomic<u64> Tail{ 0 };
+			u64              CachedHead = 0;  // Producer's last view of Head
+		};
+
+		// Written by the consumer, read by the producer
+		struct alignas(64) ConsumerLine
+		{
+			std::atomic<u64> Head{ 0 };
+			u64              CachedTail = 0;  // Consumer's last view of Tail
+		};
+
+	private:
+		ProducerLine     m_producer;
+		ConsumerLine     m_consumer;
+		alignas(64) Slot m_slots[Capacity];  // Inline, allocate large buffers on the heap
+	};
+}
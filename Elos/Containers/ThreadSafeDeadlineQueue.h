@@ -0,0 +1,170 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Containers/BinaryHeap.h>
+#include <Elos/Containers/QueueClosedError.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace Elos
+{
+	/**
+	 * @brief Blocking queue of items that become available at a deadline
+	 *
+	 * Items come out in deadline order, never before their deadline, and in push order when
+	 * deadlines tie. WaitAndPop sleeps until the earliest deadline and re-arms when an earlier item
+	 * is pushed, so deferred actions need no timer thread of their own.
+	 */
+	template <typename T, typename Clock = std::chrono::steady_clock, template <typename, typename> typename Heap = BinaryHeap>
+	class ThreadSafeDeadlineQueue
+	{
+	public:
+		using TimePoint = typename Clock::time_point;
+
+		ThreadSafeDeadlineQueue() = default;
+
+		ThreadSafeDeadlineQueue(const ThreadSafeDeadlineQueue&) = delete;
+		ThreadSafeDeadlineQueue& operator=(const ThreadSafeDeadlineQueue&) = delete;
+		ThreadSafeDeadlineQueue(ThreadSafeDeadlineQueue&&) = delete;
+		ThreadSafeDeadlineQueue& operator=(ThreadSafeDeadlineQueue&&) = delete;
+
+		// Pushes after Close are discarded
+		void Push(TimePoint deadline, T item)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_closed)
+				{
+					return;
+				}
+				m_heap.Emplace(Entry{ deadline, m_nextSequence++, std::move(item) });
+			}
+
+			// The woken waiter re-arms on the new earliest deadline if this item isn't due yet, and passes
+			// the wake on if it pops something else instead
+			m_condVar.notify_one();
+		}
+
+		template <typename Rep, typename Period>
+		void PushAfter(const std::chrono::duration<Rep, Period>& delay, T item)
+		{
+			Push(Clock::now() + delay, std::move(item));
+		}
+
+		// The earliest item if its deadline has passed
+		NODISCARD std::optional<T> TryPop()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_heap.Empty() || m_heap.Top().Deadline > Clock::now())
+			{
+				return std::nullopt;
+			}
+			return m_heap.Pop().Item;
+		}
+
+		// Throws QueueClosedError once the queue is closed and nothing is due
+		T WaitAndPop()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			for (;;)
+			{
+				if (!m_heap.Empty() && m_heap.Top().Deadline <= Clock::now())
+				{
+					T item = m_heap.Pop().Item;
+
+					// This waiter may have taken a wake meant to re-arm another one on what is left
+					if (!m_heap.Empty())
+					{
+						m_condVar.notify_one();
+					}
+					return item;
+				}
+
+				if (m_closed)
+				{
+					throw QueueClosedError();
+				}
+
+				if (m_heap.Empty())
+				{
+					m_condVar.wait(lock);
+				}
+				else
+				{
+					// wait_until reads the deadline again after unlocking, when a push may have moved the top
+					const TimePoint deadline = m_heap.Top().Deadline;
+					m_condVar.wait_until(lock, deadline);
+				}
+			}
+		}
+
+		NODISCARD std::optional<TimePoint> GetNextDeadline() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_heap.Empty())
+			{
+				return std::nullopt;
+			}
+			return m_heap.Top().Deadline;
+		}
+
+		// Wakes every waiter. Items already due can still be popped, pending ones never will be by WaitAndPop
+		void Close()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_closed = true;
+			}
+			m_condVar.notify_all();
+		}
+
+		NODISCARD bool Empty() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_heap.Empty();
+		}
+
+		NODISCARD size_t Size() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_heap.Size();
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_heap.Clear();
+		}
+
+	private:
+		struct Entry
+		{
+			TimePoint Deadline;
+			u64       Sequence;
+			T         Item;
+		};
+
+		// Later deadlines rank lower, ties go to the earlier push
+		struct EntryCompare
+		{
+			bool operator()(const Entry& a, const Entry& b) const
+			{
+				if (a.Deadline != b.Deadline)
+				{
+					return a.Deadline > b.Deadline;
+				}
+				return a.Sequence > b.Sequence;
+			}
+		};
+
+	private:
+		Heap<Entry, EntryCompare> m_heap;
+		mutable std::mutex        m_mutex;
+		std::condition_variable   m_condVar;
+		u64                       m_nextSequence = 0;
+		bool                      m_closed       = false;
+	};
+}
@@ -0,0 +1,281 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Containers/BinaryHeap.h>
+#include <Elos/Containers/QueueClosedError.h>
+#include <Elos/Containers/QueueTelemetry.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace Elos
+{
+	/**
+	 * @brief Blocking priority queue: pops the item with the highest priority first
+	 *
+	 * Compare follows std::priority_queue, Compare(a, b) is true when a ranks below b. Items of equal
+	 * priority come out in push order, so callers can layer priorities over a stream that must
+	 * otherwise stay FIFO. Heap selects the storage, BinaryHeap or PairingHeap.
+	 */
+	template <typename T, typename Compare = std::less<T>, template <typename, typename> typename Heap = BinaryHeap>
+	class ThreadSafePriorityQueue
+	{
+	public:
+		ThreadSafePriorityQueue() = default;
+		explicit ThreadSafePriorityQueue(const Compare& compare) : m_heap(EntryCompare{ compare }) {}
+
+		ThreadSafePriorityQueue(const ThreadSafePriorityQueue&) = delete;
+		ThreadSafePriorityQueue& operator=(const ThreadSafePriorityQueue&) = delete;
+		ThreadSafePriorityQueue(ThreadSafePriorityQueue&&) = delete;
+		ThreadSafePriorityQueue& operator=(ThreadSafePriorityQueue&&) = delete;
+
+		void Push(const T& item) { Emplace(item); }
+		void Push(T&& item) { Emplace(std::move(item)); }
+
+		// Pushes after Close are discarded
+		template <typename... ConstructArgs>
+		void Emplace(ConstructArgs&&... args)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_closed)
+				{
+					return;
+				}
+				Insert(std::forward<ConstructArgs>(args)...);
+			}
+			m_condVar.notify_one();
+			PublishTelemetry();
+		}
+
+		// Inserts every item of the range under a single lock, so no consumer sees part of it. Rvalue
+		// ranges are moved from
+		template <std::ranges::input_range Range>
+		void PushRange(Range&& items)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_closed)
+				{
+					return;
+				}
+				for (auto&& item : items)
+				{
+					if constexpr (std::is_rvalue_reference_v<Range&&>)
+					{
+						Insert(std::move(item));
+					}
+					else
+					{
+						Insert(std::forward<decltype(item)>(item));
+					}
+				}
+			}
+			m_condVar.notify_all();
+			PublishTelemetry();
+		}
+
+		NODISCARD std::optional<T> TryPop()
+		{
+			std::optional<T> item;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_heap.Empty())
+				{
+					return std::nullopt;
+				}
+				item.emplace(PopTop());
+			}
+			PublishTelemetry();
+			return item;
+		}
+
+		// Throws QueueClosedError once the queue is closed and drained
+		T WaitAndPop()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return !m_heap.Empty() || m_closed; });
+			if (m_heap.Empty())
+			{
+				throw QueueClosedError();
+			}
+
+			T item = PopTop();
+			lock.unlock();
+			PublishTelemetry();
+			return item;
+		}
+
+		template <typename Rep, typename Period>
+		NODISCARD std::optional<T> WaitAndPopFor(const std::chrono::duration<Rep, Period>& timeout)
+		{
+			return WaitAndPopUntil(std::chrono::steady_clock::now() + timeout);
+		}
+
+		// Nullopt if the deadline passes first or the queue is closed and drained
+		template <typename Clock, typename Duration>
+		NODISCARD std::optional<T> WaitAndPopUntil(const std::chrono::time_point<Clock, Duration>& deadline)
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			if (!m_condVar.wait_until(lock, deadline, [this] { return !m_heap.Empty() || m_closed; }) || m_heap.Empty())
+			{
+				return std::nullopt;
+			}
+
+			std::optional<T> item(PopTop());
+			lock.unlock();
+			PublishTelemetry();
+			return item;
+		}
+
+		// Moves every queued item into out, highest priority first, under a single lock. Returns how many were drained
+		template <std::output_iterator<T&&> OutputIt>
+		size_t DrainTo(OutputIt out)
+		{
+			size_t count = 0;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				for (; !m_heap.Empty(); ++count)
+				{
+					*out = PopTop();
+					++out;
+				}
+			}
+			PublishTelemetry();
+			return count;
+		}
+
+		// Wakes every waiter. Queued items can still be popped
+		void Close()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_closed = true;
+			}
+			m_condVar.notify_all();
+		}
+
+		NODISCARD bool IsClosed() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_closed;
+		}
+
+		NODISCARD bool Empty() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_heap.Empty();
+		}
+
+		NODISCARD size_t Size() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_heap.Size();
+		}
+
+		void Clear()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_heap.Clear();
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed))
+			{
+				telemetry->RecordDepth(0);
+			}
+		}
+
+		// Starts recording depth, rates and enqueue-to-dequeue latency; stays on once enabled.
+		// Items queued before this report no latency
+		QueueTelemetry& EnableTelemetry()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_telemetryStorage)
+			{
+				m_telemetryStorage = std::make_unique<QueueTelemetry>();
+				m_telemetryStorage->RecordDepth(m_heap.Size());
+				m_telemetry.store(m_telemetryStorage.get(), std::memory_order_release);
+			}
+			return *m_telemetryStorage;
+		}
+
+		// Null until EnableTelemetry is called
+		NODISCARD QueueTelemetry* GetTelemetry() const noexcept { return m_telemetry.load(std::memory_order_acquire); }
+
+	private:
+		struct Entry
+		{
+			T                Item;
+			u64              Sequence;
+			Timer::TimePoint PushedAt;  // Only taken while telemetry is enabled
+		};
+
+		// Caller holds the lock
+		template <typename... ConstructArgs>
+		void Insert(ConstructArgs&&... args)
+		{
+			QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed);
+			const Timer::TimePoint pushedAt = telemetry ? Timer::Now() : Timer::TimePoint{};
+			m_heap.Emplace(Entry{ T(std::forward<ConstructArgs>(args)...), m_nextSequence++, pushedAt });
+			if (telemetry)
+			{
+				telemetry->RecordPush(m_heap.Size(), pushedAt);
+			}
+		}
+
+		// Caller holds the lock and has checked the heap isn't empty
+		T PopTop()
+		{
+			Entry entry = m_heap.Pop();
+			QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed);
+			if (telemetry && entry.PushedAt != Timer::TimePoint{})
+			{
+				telemetry->RecordPop(m_heap.Size(), entry.PushedAt, Timer::Now());
+			}
+			return std::move(entry.Item);
+		}
+
+		void PublishTelemetry()
+		{
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_acquire))
+			{
+				telemetry->PublishIfDue();
+			}
+		}
+
+		// Ranks by Compare, then earlier pushes above later ones
+		struct EntryCompare
+		{
+			Compare Less;
+
+			bool operator()(const Entry& a, const Entry& b) const
+			{
+				if (Less(a.Item, b.Item))
+				{
+					return true;
+				}
+				if (Less(b.Item, a.Item))
+				{
+					return false;
+				}
+				return a.Sequence > b.Sequence;
+			}
+		};
+
+	private:
+		Heap<Entry, EntryCompare> m_heap;
+		mutable std::mutex        m_mutex;
+		std::condition_variable   m_condVar;
+		u64                       m_nextSequence = 0;
+		bool                      m_closed       = false;
+
+		std::unique_ptr<QueueTelemetry> m_telemetryStorage;
+		std::atomic<QueueTelemetry*>    m_telemetry{ nullptr };  // Set once by EnableTelemetry
+	};
+}
@@ -1,56 +1,245 @@
 #pragma once
 #include <Elos/Common/FunctionMacros.h>
-#include <queue>
+#include <Elos/Common/InplaceFunction.h>
+#include <Elos/Containers/QueueClosedError.h>
+#include <Elos/Containers/QueueNotifier.h>
+#include <Elos/Containers/QueueTelemetry.h>
+#include <Elos/Containers/QueueWaitStrategy.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <mutex>
 #include <condition_variable>
+#include <iterator>
+#include <memory>
 #include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
 
 namespace Elos
 {
+	class QueueSet;
+
+	// What a bounded queue does with a push that finds it full
+	enum class QueueOverflowPolicy
+	{
+		Block,       // Wait for a consumer to make room
+		DropOldest,  // Discard the front item to make room
+		DropNewest,  // Discard the incoming item
+		Coalesce,    // Merge the incoming item into the last one, drop the oldest if they don't merge
+	};
+
+	struct QueueCounters
+	{
+		u64 Dropped   = 0;  // Items discarded by an overflow policy or pushed after Close
+		u64 Coalesced = 0;  // Pushes merged into the last item
+		u64 HighWater = 0;  // Largest size the queue has reached
+	};
+
 	template<typename T>
 	class ThreadSafeQueue
 	{
 	public:
+		// Returns true when incoming was merged into last and should not be queued on its own
+		using CoalesceFunction = InplaceFunction<bool(T& last, const T& incoming)>;
+
 		ThreadSafeQueue() = default;
 		~ThreadSafeQueue() = default;
 
+		// Bounded queue holding at most capacity items
+		explicit ThreadSafeQueue(size_t capacity, QueueOverflowPolicy policy = QueueOverflowPolicy::Block, CoalesceFunction coalesce = {})
+			: m_capacity(capacity)
+			, m_policy(policy)
+			, m_coalesce(std::move(coalesce))
+		{
+		}
+
 		ThreadSafeQueue(const ThreadSafeQueue&) = delete;
 		ThreadSafeQueue& operator=(const ThreadSafeQueue&) = delete;
 		ThreadSafeQueue(ThreadSafeQueue&&) = delete;
 		ThreadSafeQueue& operator=(ThreadSafeQueue&&) = delete;
 
-		void Push(const T& item)
+		// Set before any thread waits on the queue
+		void SetWaitStrategy(const QueueWaitStrategy& strategy) noexcept { m_waitStrategy = strategy; }
+		NODISCARD const QueueWaitStrategy& GetWaitStrategy() const noexcept { return m_waitStrategy; }
+
+		void Push(const T& item) { Emplace(item); }
+		void Push(T&& item) { Emplace(std::move(item)); }
+
+		template <typename... ConstructArgs>
+		void Emplace(ConstructArgs&&... args)
 		{
+			bool queued = false;
+			bool wakeTimed = false;
 			{
-				std::lock_guard<std::mutex> lock(m_mutex);
-				m_queue.push(item);
+				std::unique_lock<std::mutex> lock(m_mutex);
+				queued = Insert(lock, std::forward<ConstructArgs>(args)...);
+				wakeTimed = m_timedWaiters != 0;
+				if (queued)
+				{
+					NotifySet();
+				}
 			}
-			m_condVar.notify_one();
+
+			if (queued)
+			{
+				WakeConsumers(false, wakeTimed);
+			}
+			PublishTelemetry();
 		}
 
-		NODISCARD std::optional<T> TryPop()
+		// Appends every item of the range under a single lock. Rvalue ranges are moved from
+		template <std::ranges::input_range Range>
+		void PushRange(Range&& items)
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-			if (m_queue.empty())
+			size_t count = 0;
+			bool wakeTimed = false;
 			{
-				return std::nullopt;
+				std::unique_lock<std::mutex> lock(m_mutex);
+				for (auto&& item : items)
+				{
+					if constexpr (std::is_rvalue_reference_v<Range&&>)
+					{
+						count += Insert(lock, std::move(item));
+					}
+					else
+					{
+						count += Insert(lock, std::forward<decltype(item)>(item));
+					}
+				}
+				wakeTimed = m_timedWaiters != 0;
+				if (count != 0)
+				{
+					NotifySet();
+				}
 			}
 
-			T item = m_queue.front();
-			m_queue.pop();
+			if (count != 0)
+			{
+				WakeConsumers(count > 1, wakeTimed);
+			}
+			PublishTelemetry();
+		}
+
+		NODISCARD std::optional<T> TryPop()
+		{
+			std::optional<T> item;
+			(void)TakeFront(item);
 			return item;
 		}
 
+		// Waits as the wait strategy says. Throws QueueClosedError once the queue is closed and drained
 		T WaitAndPop()
 		{
-			std::unique_lock<std::mutex> lock(m_mutex);
-			m_condVar.wait(lock, [this] { return !m_queue.empty(); });
+			std::optional<T> item;
+			Internal::SpinUntil(m_waitStrategy, [this] { return IsReady(); });
+
+			for (;;)
+			{
+				// Arm before the check so a push that lands after it is sure to move the epoch
+				m_parked.fetch_add(1, std::memory_order_relaxed);
+				const u32 epoch = m_epoch.load(std::memory_order_acquire);
+				const TakeResult result = TakeFront(item);
+				if (result == TakeResult::Empty)
+				{
+					m_epoch.wait(epoch, std::memory_order_acquire);
+				}
+				m_parked.fetch_sub(1, std::memory_order_relaxed);
+
+				if (result == TakeResult::Taken)
+				{
+					return std::move(*item);
+				}
+				if (result == TakeResult::Closed)
+				{
+					throw QueueClosedError();
+				}
+			}
+		}
+
+		template <typename Rep, typename Period>
+		NODISCARD std::optional<T> WaitAndPopFor(const std::chrono::duration<Rep, Period>& timeout)
+		{
+			return WaitAndPopUntil(std::chrono::steady_clock::now() + timeout);
+		}
+
+		// Nullopt if the deadline passes first or the queue is closed and drained
+		template <typename Clock, typename Duration>
+		NODISCARD std::optional<T> WaitAndPopUntil(const std::chrono::time_point<Clock, Duration>& deadline)
+		{
+			Internal::SpinUntil(m_waitStrategy, [this] { return IsReady(); });
+
+			std::optional<T> item;
+			{
+				// std::atomic has no timed wait, so timed waiters park on the condition variable instead
+				std::unique_lock<std::mutex> lock(m_mutex);
+				++m_timedWaiters;
+				m_notEmpty.wait_until(lock, deadline, [this] { return !m_queue.empty() || m_closed.load(std::memory_order_relaxed); });
+				--m_timedWaiters;
 
-			T item = m_queue.front();
-			m_queue.pop();
+				if (m_queue.empty())
+				{
+					return std::nullopt;
+				}
+				item.emplace(PopFront());
+			}
+			NotifyNotFull();
+			PublishTelemetry();
 			return item;
 		}
 
+		// Wakes every waiting consumer and blocked producer. Items already queued can still be popped,
+		// later pushes are discarded and counted as dropped
+		void Close()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_closed.store(true, std::memory_order_release);
+				NotifySet();
+			}
+
+			WakeConsumers(true, true);
+			m_notFull.notify_all();
+		}
+
+		NODISCARD bool IsClosed() const noexcept { return m_closed.load(std::memory_order_acquire); }
+
+		// Moves every queued item into out under a single lock, returns how many were drained
+		template <std::output_iterator<T&&> OutputIt>
+		size_t DrainTo(OutputIt out)
+		{
+			size_t count = 0;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				count = m_queue.size();
+				if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed))
+				{
+					telemetry->RecordPops(0, m_queue | std::views::transform(&Entry::PushedAt), Timer::Now());
+				}
+
+				for (Entry& entry : m_queue)
+				{
+					*out = std::move(entry.Item);
+					++out;
+				}
+				m_queue.clear();
+				m_available.store(0, std::memory_order_relaxed);
+			}
+			NotifyNotFull();
+			PublishTelemetry();
+			return count;
+		}
+
+		// Replaces the contents of out with every queued item under a single lock. Reuses out's
+		// capacity, so a caller keeping the vector around drains without allocating
+		size_t SwapOut(std::vector<T>& out)
+		{
+			out.clear();
+			return DrainTo(std::back_inserter(out));
+		}
+
 		bool Empty() const
 		{
 			std::lock_guard<std::mutex> lock(m_mutex);
@@ -64,15 +253,248 @@ namespace Elos
 		}
 
 		void Clear()
+		{
+			std::deque<Entry> discarded;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				std::swap(m_queue, discarded);
+				m_available.store(0, std::memory_order_relaxed);
+				if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed))
+				{
+					telemetry->RecordDepth(0);
+				}
+			}
+			NotifyNotFull();
+		}
+
+		NODISCARD QueueCounters GetCounters() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_counters;
+		}
+
+		// Starts recording depth, rates and enqueue-to-dequeue latency. Once enabled it stays on for the
+		// queue's lifetime; items already queued are treated as pushed now
+		QueueTelemetry& EnableTelemetry()
 		{
 			std::lock_guard<std::mutex> lock(m_mutex);
-			std::queue<T> empty;
-			std::swap(m_queue, empty);
+			if (!m_telemetryStorage)
+			{
+				const Timer::TimePoint now = Timer::Now();
+				for (Entry& entry : m_queue)
+				{
+					entry.PushedAt = now;
+				}
+
+				m_telemetryStorage = std::make_unique<QueueTelemetry>();
+				m_telemetryStorage->RecordDepth(m_queue.size());
+				m_telemetry.store(m_telemetryStorage.get(), std::memory_order_release);
+			}
+			return *m_telemetryStorage;
 		}
 
+		// Null until EnableTelemetry is called
+		NODISCARD QueueTelemetry* GetTelemetry() const noexcept { return m_telemetry.load(std::memory_order_acquire); }
+
+		// Zero for an unbounded queue
+		NODISCARD size_t GetCapacity() const noexcept { return m_capacity; }
+		NODISCARD QueueOverflowPolicy GetPolicy() const noexcept { return m_policy; }
+
 	private:
-		std::queue<T>           m_queue;
+		friend class QueueSet;
+
+		// Items carry their push time, taken only while telemetry is enabled
+		struct Entry
+		{
+			template <typename... ConstructArgs>
+			explicit Entry(Timer::TimePoint pushedAt, ConstructArgs&&... args)
+				: Item(std::forward<ConstructArgs>(args)...)
+				, PushedAt(pushedAt)
+			{
+			}
+
+			T                Item;
+			Timer::TimePoint PushedAt;
+		};
+
+		enum class TakeResult
+		{
+			Taken,
+			Empty,
+			Closed,  // Empty and no more items will arrive
+		};
+
+		// Called by QueueSet; a queue belongs to at most one set at a time
+		void SetNotifier(QueueNotifier* notifier)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_notifier = notifier;
+		}
+
+		// m_mutex must be held, so a set that detaches under it can't be destroyed mid-Notify once its
+		// consumer has seen the item or the close
+		void NotifySet()
+		{
+			if (m_notifier)
+			{
+				m_notifier->Notify();
+			}
+		}
+
+		// Lock-free hint for the spin phase, confirmed under the lock before popping
+		NODISCARD bool IsReady() const noexcept
+		{
+			return m_available.load(std::memory_order_acquire) != 0 || m_closed.load(std::memory_order_acquire);
+		}
+
+		TakeResult TakeFront(std::optional<T>& item)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_queue.empty())
+				{
+					return m_closed.load(std::memory_order_relaxed) ? TakeResult::Closed : TakeResult::Empty;
+				}
+				item.emplace(PopFront());
+			}
+			NotifyNotFull();
+			PublishTelemetry();
+			return TakeResult::Taken;
+		}
+
+		// Applies the overflow policy and appends the item, returns whether the queue gained an item
+		template <typename... ConstructArgs>
+		bool Insert(std::unique_lock<std::mutex>& lock, ConstructArgs&&... args)
+		{
+			if (m_closed.load(std::memory_order_relaxed))
+			{
+				++m_counters.Dropped;
+				return false;
+			}
+
+			if (m_capacity != 0 && m_queue.size() >= m_capacity)
+			{
+				switch (m_policy)
+				{
+				case QueueOverflowPolicy::Block:
+					// Earlier items of a PushRange may be what the consumer is waiting for
+					WakeConsumers(true, true);
+					m_notFull.wait(lock, [this] { return m_queue.size() < m_capacity || m_closed.load(std::memory_order_relaxed); });
+					if (m_closed.load(std::memory_order_relaxed))
+					{
+						++m_counters.Dropped;
+						return false;
+					}
+					break;
+
+				case QueueOverflowPolicy::DropOldest:
+					m_queue.pop_front();
+					++m_counters.Dropped;
+					break;
+
+				case QueueOverflowPolicy::DropNewest:
+					++m_counters.Dropped;
+					return false;
+
+				case QueueOverflowPolicy::Coalesce:
+				{
+					T incoming(std::forward<ConstructArgs>(args)...);
+					if (m_coalesce && m_coalesce(m_queue.back().Item, incoming))
+					{
+						++m_counters.Coalesced;
+						return false;
+					}
+
+					m_queue.pop_front();
+					++m_counters.Dropped;
+					m_queue.emplace_back(PushTime(), std::move(incoming));
+					RecordPush();
+					return true;
+				}
+				}
+			}
+
+			m_queue.emplace_back(PushTime(), std::forward<ConstructArgs>(args)...);
+			m_available.store(m_queue.size(), std::memory_order_release);
+			m_counters.HighWater = std::max<u64>(m_counters.HighWater, m_queue.size());
+			RecordPush();
+			return true;
+		}
+
+		NODISCARD Timer::TimePoint PushTime() const noexcept
+		{
+			return m_telemetry.load(std::memory_order_relaxed) ? Timer::Now() : Timer::TimePoint{};
+		}
+
+		void RecordPush()
+		{
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed))
+			{
+				telemetry->RecordPush(m_queue.size(), m_queue.back().PushedAt);
+			}
+		}
+
+		void PublishTelemetry()
+		{
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_acquire))
+			{
+				telemetry->PublishIfDue();
+			}
+		}
+
+		// Caller holds the lock and has checked the queue isn't empty
+		T PopFront()
+		{
+			Entry entry = std::move(m_queue.front());
+			m_queue.pop_front();
+			m_available.store(m_queue.size(), std::memory_order_relaxed);
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_relaxed))
+			{
+				telemetry->RecordPop(m_queue.size(), entry.PushedAt, Timer::Now());
+			}
+			return std::move(entry.Item);
+		}
+
+		void WakeConsumers(bool all, bool timed)
+		{
+			m_epoch.fetch_add(1, std::memory_order_release);
+			if (m_parked.load(std::memory_order_relaxed) != 0)
+			{
+				all ? m_epoch.notify_all() : m_epoch.notify_one();
+			}
+
+			if (timed)
+			{
+				all ? m_notEmpty.notify_all() : m_notEmpty.notify_one();
+			}
+		}
+
+		void NotifyNotFull()
+		{
+			if (m_policy == QueueOverflowPolicy::Block && m_capacity != 0)
+			{
+				m_notFull.notify_all();
+			}
+		}
+
+	private:
+		std::deque<Entry>       m_queue;
 		mutable std::mutex      m_mutex;
-		std::condition_variable m_condVar;
+		std::condition_variable m_notEmpty;        // Timed waiters park here
+		std::condition_variable m_notFull;
+		size_t                  m_timedWaiters = 0;
+		std::atomic<u32>        m_epoch{ 0 };      // Bumped on every push and on Close, untimed waiters park on it
+		std::atomic<u32>        m_parked{ 0 };
+		std::atomic<size_t>     m_available{ 0 };  // Mirrors m_queue.size() for the spin phase
+		std::atomic<bool>       m_closed{ false };
+		QueueWaitStrategy       m_waitStrategy;
+		size_t                  m_capacity = 0;    // Zero means unbounded
+		QueueOverflowPolicy     m_policy   = QueueOverflowPolicy::Block;
+		CoalesceFunction        m_coalesce;
+		QueueCounters           m_counters;
+		QueueNotifier*          m_notifier = nullptr;  // Set while the queue is part of a QueueSet
+
+		std::unique_ptr<QueueTelemetry> m_telemetryStorage;
+		std::atomic<QueueTelemetry*>    m_telemetry{ nullptr };  // Set once by EnableTelemetry
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,411 @@
+#pragma once
+#include <Elos/Event/Signal.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Elos
+{
+	template <typename... Args> class ConcurrentConnection;
+
+	namespace Internal
+	{
+		// Spreads readers of an epoch over several cache lines so emitters on different threads
+		// don't all hammer the same counter
+		inline u32 CurrentThreadStripe() noexcept
+		{
+			static std::atomic<u32> s_nextStripe{ 0 };
+			thread_local const u32 stripe = s_nextStripe.fetch_add(1, std::memory_order_relaxed);
+			return stripe;
+		}
+	}
+
+	/**
+	 * @brief Signal that can be emitted from any number of threads while others connect and disconnect
+	 *
+	 * Emit takes no lock: it reads an immutable snapshot of the slot array. Connect/Disconnect copy
+	 * the current snapshot, publish the modified copy and retire the old one. Retired snapshots are
+	 * reclaimed once every emitter that could still see them has left (two-epoch grace periods).
+	 * Mutators serialize on a mutex, emitters never wait on it.
+	 *
+	 * Connect returns a ConcurrentConnection, which like Signal's Connection may outlive the signal.
+	 * It must not be used to disconnect while the signal is being destroyed.
+	 */
+	template <typename... Args>
+	class ConcurrentSignal
+	{
+	public:
+		using SlotFunction = Internal::SlotFunction<void(Args...)>;
+		using ConnectionId = u64;  // 0 is never a valid id
+
+		ConcurrentSignal() = default;
+		ConcurrentSignal(const ConcurrentSignal&) = delete;
+		ConcurrentSignal& operator=(const ConcurrentSignal&) = delete;
+		ConcurrentSignal(ConcurrentSignal&&) = delete;
+		ConcurrentSignal& operator=(ConcurrentSignal&&) = delete;
+
+		// No emission may be in flight when the signal is destroyed
+		~ConcurrentSignal()
+		{
+			*m_anchor = nullptr;
+			std::lock_guard<std::mutex> lock(m_writeMutex);
+
+			if (const Snapshot* current = m_snapshot.load(std::memory_order_relaxed))
+			{
+				for (SlotNode* node : current->Slots)
+				{
+					delete node;
+				}
+				delete current;
+			}
+
+			for (const Retired& retired : m_retired)
+			{
+				delete retired.Snap;
+				delete retired.Node;
+			}
+		}
+
+		template <Invocable<Args...> Callable>
+		NODISCARD ConcurrentConnection<Args...> Connect(Callable&& callable)
+		{
+			return ConcurrentConnection<Args...>(m_anchor, Insert(new SlotNode{ .Id = 0, .Function = SlotFunction(std::forward<Callable>(callable)) }));
+		}
+
+		// Queued connection: runs the callable on the mailbox's thread, posting to it when emitted elsewhere
+		template <Invocable<Args...> Callable>
+		NODISCARD ConcurrentConnection<Args...> Connect(Callable&& callable, std::shared_ptr<Mailbox> mailbox)
+		{
+			auto [forwarder, target] = Internal::MakeQueuedSlot<Args...>(std::forward<Callable>(callable), std::move(mailbox));
+
+			// Mark the node before it becomes visible so Disconnect can always revoke it
+			SlotNode* node = new SlotNode{ .Id = 0, .Function = SlotFunction(std::move(forwarder)), .Queued = std::move(target) };
+			return ConcurrentConnection<Args...>(m_anchor, Insert(node));
+		}
+
+		NODISCARD bool Disconnect(ConnectionId id)
+		{
+			std::lock_guard<std::mutex> lock(m_writeMutex);
+
+			const Snapshot* current = m_snapshot.load(std::memory_order_relaxed);
+			if (!current)
+			{
+				return false;
+			}
+
+			SlotNode* removed = nullptr;
+			Snapshot* next = new Snapshot;
+			next->Slots.reserve(current->Slots.size());
+			for (SlotNode* node : current->Slots)
+			{
+				if (node->Id == id)
+				{
+					removed = node;
+				}
+				else
+				{
+					next->Slots.push_back(node);
+				}
+			}
+
+			if (!removed)
+			{
+				delete next;
+				return false;
+			}
+
+			if (removed->Queued)
+			{
+				removed->Queued->Revoke();
+			}
+
+			if (next->Slots.empty())
+			{
+				delete next;
+				next = nullptr;
+			}
+
+			Publish(next, current, removed);
+			return true;
+		}
+
+		void DisconnectAll()
+		{
+			std::lock_guard<std::mutex> lock(m_writeMutex);
+
+			const Snapshot* current = m_snapshot.load(std::memory_order_relaxed);
+			if (!current)
+			{
+				return;
+			}
+
+			const u64 epoch = m_epoch.load(std::memory_order_seq_cst);
+			for (SlotNode* node : current->Slots)
+			{
+				if (node->Queued)
+				{
+					node->Queued->Revoke();
+				}
+				m_retired.push_back(Retired{ .Snap = nullptr, .Node = node, .Epoch = epoch });
+			}
+
+			Publish(nullptr, current, nullptr);
+		}
+
+		void Emit(Args... args) const
+		{
+			ReadScope scope(*this);
+
+			if (const Snapshot* snapshot = m_snapshot.load(std::memory_order_seq_cst))
+			{
+				for (const SlotNode* node : snapshot->Slots)
+				{
+					node->Function(args...);
+				}
+			}
+		}
+
+		NODISCARD bool IsConnected(ConnectionId id) const
+		{
+			ReadScope scope(*this);
+
+			if (const Snapshot* snapshot = m_snapshot.load(std::memory_order_seq_cst))
+			{
+				for (const SlotNode* node : snapshot->Slots)
+				{
+					if (node->Id == id)
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		NODISCARD u64 ConnectionCount() const noexcept { return m_connectionCount.load(std::memory_order_relaxed); }
+		NODISCARD bool HasConnections() const noexcept { return ConnectionCount() != 0; }
+
+		void operator()(Args... args) const
+		{
+			Emit(std::forward<Args>(args)...);
+		}
+
+	private:
+		struct SlotNode
+		{
+			ConnectionId                                Id;
+			SlotFunction                                Function;
+			std::shared_ptr<Internal::QueuedTargetBase> Queued = nullptr;
+		};
+
+		struct Snapshot
+		{
+			std::vector<SlotNode*> Slots;
+		};
+
+		struct Retired
+		{
+			const Snapshot* Snap;
+			SlotNode*       Node;
+			u64             Epoch;  // Epoch at which it was unlinked
+		};
+
+		struct alignas(64) ReaderCounter  // One cache line each
+		{
+			std::atomic<u64> Count{ 0 };
+		};
+
+		static constexpr u32 StripeCount = 16;
+
+		// Registers the emitter in the current epoch for the duration of the emission
+		class ReadScope
+		{
+		public:
+			explicit ReadScope(const ConcurrentSignal& signal)
+				: m_counter(nullptr)
+			{
+				const u32 stripe = Internal::CurrentThreadStripe() % StripeCount;
+				for (;;)
+				{
+					const u64 epoch = signal.m_epoch.load(std::memory_order_seq_cst);
+					ReaderCounter& counter = signal.m_readers[epoch & 1][stripe];
+					counter.Count.fetch_add(1, std::memory_order_seq_cst);
+
+					// If the epoch advanced in between, a reclaimer may have missed us
+					if (signal.m_epoch.load(std::memory_order_seq_cst) == epoch) LIKELY
+					{
+						m_counter = &counter;
+						return;
+					}
+
+					counter.Count.fetch_sub(1, std::memory_order_release);
+				}
+			}
+
+			~ReadScope()
+			{
+				m_counter->Count.fetch_sub(1, std::memory_order_release);
+			}
+
+			ReadScope(const ReadScope&) = delete;
+			ReadScope& operator=(const ReadScope&) = delete;
+
+		private:
+			ReaderCounter* m_counter;
+		};
+
+		NODISCARD ConnectionId Insert(SlotNode* node)
+		{
+			std::lock_guard<std::mutex> lock(m_writeMutex);
+			node->Id = ++m_lastId;
+
+			const Snapshot* current = m_snapshot.load(std::memory_order_relaxed);
+			Snapshot* next = new Snapshot;
+			if (current)
+			{
+				next->Slots.reserve(current->Slots.size() + 1);
+				next->Slots = current->Slots;
+			}
+			next->Slots.push_back(node);
+
+			Publish(next, current, nullptr);
+			return node->Id;
+		}
+
+		// Must be called with m_writeMutex held
+		void Publish(const Snapshot* next, const Snapshot* current, SlotNode* removed)
+		{
+			m_snapshot.store(next, std::memory_order_seq_cst);
+			m_connectionCount.store(next ? next->Slots.size() : 0, std::memory_order_relaxed);
+
+			if (current || removed)
+			{
+				m_retired.push_back(Retired
+				{
+					.Snap  = current,
+					.Node  = removed,
+					.Epoch = m_epoch.load(std::memory_order_seq_cst)
+				});
+			}
+
+			TryReclaim();
+		}
+
+		NODISCARD u64 ReaderCount(u64 parity) const noexcept
+		{
+			u64 count = 0;
+			for (const ReaderCounter& counter : m_readers[parity])
+			{
+				count += counter.Count.load(std::memory_order_seq_cst);
+			}
+			return count;
+		}
+
+		// Advances the epoch when no stragglers from the previous one remain. After advancing to E + 1
+		// only readers of E and E + 1 can be active, so anything unlinked at E - 1 or earlier is unreachable.
+		// Never blocks, which keeps Disconnect from inside a slot safe; whatever can't be freed yet is
+		// picked up by a later mutation.
+		void TryReclaim()
+		{
+			for (u32 attempt = 0; attempt < 2; ++attempt)
+			{
+				const u64 epoch = m_epoch.load(std::memory_order_seq_cst);
+				if (ReaderCount((epoch + 1) & 1) != 0)
+				{
+					break;
+				}
+				m_epoch.store(epoch + 1, std::memory_order_seq_cst);
+
+				std::erase_if(m_retired, [epoch](const Retired& retired)
+				{
+					if (retired.Epoch + 1 > epoch)
+					{
+						return false;
+					}
+
+					delete retired.Snap;
+					delete retired.Node;
+					return true;
+				});
+			}
+		}
+
+	private:
+		std::atomic<const Snapshot*> m_snapshot{ nullptr };
+		std::atomic<u64>             m_epoch{ 0 };
+		std::atomic<u64>             m_connectionCount{ 0 };
+		mutable ReaderCounter        m_readers[2][StripeCount];
+		std::mutex                   m_writeMutex;
+		std::vector<Retired>         m_retired;
+		ConnectionId                 m_lastId = 0;
+
+		// Lets connections detect that the signal died; the signal can't move, so it is set once
+		std::shared_ptr<ConcurrentSignal*> m_anchor = std::make_shared<ConcurrentSignal*>(this);
+	};
+
+	// Handle to a ConcurrentSignal slot. The signal may be used from any thread, a single handle may not
+	template <typename... Args>
+	class ConcurrentConnection
+	{
+	public:
+		using ConnectionId = typename ConcurrentSignal<Args...>::ConnectionId;
+
+		ConcurrentConnection() = default;
+
+		ConcurrentConnection(std::weak_ptr<ConcurrentSignal<Args...>*> signal, ConnectionId id)
+			: m_signal(std::move(signal))
+			, m_id(id)
+		{
+		}
+
+		ConcurrentConnection(ConcurrentConnection&&) noexcept = default;
+		ConcurrentConnection(const ConcurrentConnection&) = default;
+		~ConcurrentConnection() = default;
+		ConcurrentConnection& operator=(ConcurrentConnection&&) noexcept = default;
+		ConcurrentConnection& operator=(const ConcurrentConnection&) = default;
+
+		bool Disconnect()
+		{
+			const std::shared_ptr<ConcurrentSignal<Args...>*> anchor = m_signal.lock();
+			const ConnectionId id = std::exchange(m_id, 0);
+			m_signal.reset();
+
+			return anchor && *anchor && (*anchor)->Disconnect(id);
+		}
+
+		NODISCARD bool IsConnected() const
+		{
+			const std::shared_ptr<ConcurrentSignal<Args...>*> anchor = m_signal.lock();
+			return anchor && *anchor && (*anchor)->IsConnected(m_id);
+		}
+
+		NODISCARD auto Id() const noexcept
+		{
+			return m_id;
+		}
+
+	private:
+		std::weak_ptr<ConcurrentSignal<Args...>*> m_signal;
+		ConnectionId                              m_id = 0;
+	};
+
+	template <typename... Args>
+	class ScopedConcurrentConnection : public ConcurrentConnection<Args...>
+	{
+	public:
+		using ConcurrentConnection<Args...>::ConcurrentConnection;
+
+		ScopedConcurrentConnection(ConcurrentConnection<Args...>&& conn) noexcept
+			: ConcurrentConnection<Args...>(std::move(conn)) {}
+		ScopedConcurrentConnection(ScopedConcurrentConnection&&) noexcept = default;
+		ScopedConcurrentConnection(const ScopedConcurrentConnection&) = delete;
+
+		~ScopedConcurrentConnection()
+		{
+			this->Disconnect();
+		}
+
+		ScopedConcurrentConnection& operator=(ScopedConcurrentConnection&&) noexcept = default;
+		ScopedConcurrentConnection& operator=(const ScopedConcurrentConnection&) = delete;
+	};
+}
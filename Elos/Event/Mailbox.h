@@ -0,0 +1,326 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Utils/Timer.h>
+#include <algorithm>
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace Elos
+{
+	namespace Internal
+	{
+		// Shared by a queued connection and the messages posted for it, so messages still in flight
+		// when the connection is cut are dropped instead of calling into a dead slot
+		class QueuedTargetBase
+		{
+		public:
+			void Revoke() noexcept { m_alive.store(false, std::memory_order_release); }
+			NODISCARD bool IsAlive() const noexcept { return m_alive.load(std::memory_order_acquire); }
+
+		private:
+			std::atomic<bool> m_alive{ true };
+		};
+	}
+
+	struct MailboxStats
+	{
+		u64 Posted           = 0;  // Messages posted since creation
+		u64 Executed         = 0;  // Messages run by Pump()
+		u64 Discarded        = 0;  // Messages dropped because their connection was cut
+		u64 Depth            = 0;  // Messages currently waiting
+		u64 PeakDepth        = 0;
+		u64 Batches          = 0;  // Non-empty Pump() calls
+		f64 LastMaxLatencyMs = 0.0;  // Worst post-to-run latency of the last batch
+		f64 MaxLatencyMs     = 0.0;
+		f64 AvgLatencyMs     = 0.0;
+	};
+
+	/**
+	 * @brief Per-thread queue of deferred calls, used for queued (thread-affine) signal connections
+	 *
+	 * Posting packs the target and a copy of the arguments into a bump-allocated arena block, so a
+	 * post costs no heap allocation once the arena has warmed up. The owning thread runs everything
+	 * posted so far with Pump(), swapping buffers under a single lock acquisition.
+	 */
+	class Mailbox
+	{
+	public:
+		Mailbox() : m_owner(std::this_thread::get_id()) {}
+
+		~Mailbox()
+		{
+			m_incoming.Clear();
+			m_processing.Clear();
+		}
+
+		Mailbox(const Mailbox&) = delete;
+		Mailbox& operator=(const Mailbox&) = delete;
+		Mailbox(Mailbox&&) = delete;
+		Mailbox& operator=(Mailbox&&) = delete;
+
+		// Mailbox of the calling thread, created on first use
+		NODISCARD static const std::shared_ptr<Mailbox>& ForCurrentThread()
+		{
+			thread_local const std::shared_ptr<Mailbox> s_mailbox = std::make_shared<Mailbox>();
+			return s_mailbox;
+		}
+
+		NODISCARD bool IsOwnerThread() const noexcept { return std::this_thread::get_id() == m_owner; }
+
+		// Target must derive from Internal::QueuedTargetBase and be callable with lvalues of Values...
+		template <typename Target, typename... Values>
+		void Post(const std::shared_ptr<Target>& target, Values&&... values)
+		{
+			using MessageType = Message<Target, std::decay_t<Values>...>;
+			static_assert(sizeof(MessageType) <= ChunkSize, "Message payload too large for a mailbox chunk");
+			static_assert(alignof(MessageType) <= alignof(std::max_align_t), "Over-aligned message payloads are not supported");
+
+			const Timer::TimePoint now = Timer::Now();
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			void* storage = m_incoming.Allocate(sizeof(MessageType), alignof(MessageType));
+			m_incoming.Link(new (storage) MessageType(target, now, std::forward<Values>(values)...));
+
+			++m_stats.Posted;
+			++m_stats.Depth;
+			m_stats.PeakDepth = std::max(m_stats.PeakDepth, m_stats.Depth);
+		}
+
+		// Runs every message posted before the call. Must be called from the owning thread.
+		// Returns the number of messages executed. If a slot throws, the exception propagates and the
+		// messages after it run first on the next call. A Pump from inside a slot, e.g. a nested modal
+		// loop, only runs the rest of the current batch: the running message still lives in its buffer,
+		// so newer posts wait for the outermost Pump
+		u64 Pump()
+		{
+			struct DepthGuard
+			{
+				u32& Depth;
+				explicit DepthGuard(u32& depth) : Depth(depth) { ++Depth; }
+				~DepthGuard() { --Depth; }
+			};
+
+			DepthGuard depth(m_pumpDepth);
+			u64 executed = m_processing.Head ? RunProcessing() : 0;
+			if (m_pumpDepth > 1)
+			{
+				return executed;
+			}
+
+			// Nothing runs from m_processing any more, so its chunks can be reused
+			m_processing.Reset();
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (!m_incoming.Head)
+				{
+					return executed;
+				}
+				std::swap(m_incoming, m_processing);
+			}
+			return executed + RunProcessing();
+		}
+
+		NODISCARD MailboxStats GetStats() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_stats;
+		}
+
+	private:
+		struct BatchStats
+		{
+			u64 Executed  = 0;
+			u64 Discarded = 0;
+			f64 TotalMs   = 0.0;
+			f64 MaxMs     = 0.0;
+		};
+
+		// Runs and destroys the messages in m_processing. Each one is unlinked before it runs, so a
+		// throwing slot leaves only the messages after it queued and nothing is destroyed twice. The
+		// buffer itself is only reset by the outermost Pump
+		u64 RunProcessing()
+		{
+			struct RecordOnExit
+			{
+				Mailbox&    Owner;
+				BatchStats& Batch;
+				~RecordOnExit() { Owner.RecordBatch(Batch); }
+			};
+
+			struct DestroyOnExit
+			{
+				MessageHeader* Message;
+				~DestroyOnExit() { Message->Destroy(Message); }
+			};
+
+			BatchStats batch;
+			RecordOnExit record{ *this, batch };
+
+			while (MessageHeader* message = m_processing.Head)
+			{
+				m_processing.Head = message->Next;
+				DestroyOnExit destroy{ message };
+
+				const f64 latencyMs = Timer::DurationInMilliseconds(message->Posted, Timer::Now());
+				batch.TotalMs += latencyMs;
+				batch.MaxMs    = std::max(batch.MaxMs, latencyMs);
+
+				// A slot that throws still counts as run
+				++batch.Executed;
+				if (!message->Invoke(message))
+				{
+					--batch.Executed;
+					++batch.Discarded;
+				}
+			}
+
+			return batch.Executed;
+		}
+
+		void RecordBatch(const BatchStats& batch)
+		{
+			const u64 batchSize = batch.Executed + batch.Discarded;
+			if (batchSize == 0)
+			{
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stats.AvgLatencyMs     = (m_stats.AvgLatencyMs * (m_stats.Executed + m_stats.Discarded) + batch.TotalMs)
+				/ static_cast<f64>(m_stats.Executed + m_stats.Discarded + batchSize);
+			m_stats.Executed        += batch.Executed;
+			m_stats.Discarded       += batch.Discarded;
+			m_stats.Depth           -= batchSize;
+			m_stats.LastMaxLatencyMs = batch.MaxMs;
+			m_stats.MaxLatencyMs     = std::max(m_stats.MaxLatencyMs, batch.MaxMs);
+			++m_stats.Batches;
+		}
+
+		struct MessageHeader
+		{
+			bool (*Invoke)(MessageHeader*);
+			void (*Destroy)(MessageHeader*);
+			MessageHeader*   Next = nullptr;
+			Timer::TimePoint Posted;
+		};
+
+		template <typename Target, typename... Values>
+		struct Message final : MessageHeader
+		{
+			template <typename... Forwarded>
+			Message(const std::shared_ptr<Target>& target, Timer::TimePoint posted, Forwarded&&... values)
+				: MessageHeader{ .Invoke = &Message::InvokeImpl, .Destroy = &Message::DestroyImpl, .Next = nullptr, .Posted = posted }
+				, TargetPtr(target)
+				, Payload(std::forward<Forwarded>(values)...)
+			{
+			}
+
+			static bool InvokeImpl(MessageHeader* header)
+			{
+				Message* message = static_cast<Message*>(header);
+				if (!message->TargetPtr->IsAlive())
+				{
+					return false;
+				}
+
+				std::apply(*message->TargetPtr, message->Payload);
+				return true;
+			}
+
+			static void DestroyImpl(MessageHeader* header)
+			{
+				static_cast<Message*>(header)->~Message();
+			}
+
+			std::shared_ptr<Target> TargetPtr;
+			std::tuple<Values...>   Payload;
+		};
+
+		static constexpr u64 ChunkSize = 16 * 1024;
+
+		// Bump allocator over fixed-size chunks that are kept and reused between batches
+		struct MessageBuffer
+		{
+			std::vector<std::unique_ptr<std::byte[]>> Chunks;
+			u64            CurrentChunk = 0;
+			u64            Used         = 0;
+			MessageHeader* Head         = nullptr;
+			MessageHeader* Tail         = nullptr;
+
+			void* Allocate(u64 size, u64 alignment)
+			{
+				for (;;)
+				{
+					if (CurrentChunk < Chunks.size())
+					{
+						const u64 offset = (Used + alignment - 1) & ~(alignment - 1);
+						if (offset + size <= ChunkSize)
+						{
+							Used = offset + size;
+							return Chunks[CurrentChunk].get() + offset;
+						}
+
+						++CurrentChunk;
+						Used = 0;
+						continue;
+					}
+
+					Chunks.push_back(std::make_unique<std::byte[]>(ChunkSize));
+				}
+			}
+
+			void Link(MessageHeader* message) noexcept
+			{
+				if (Tail)
+				{
+					Tail->Next = message;
+				}
+				else
+				{
+					Head = message;
+				}
+				Tail = message;
+			}
+
+			void Reset() noexcept
+			{
+				CurrentChunk = 0;
+				Used         = 0;
+				Head         = nullptr;
+				Tail         = nullptr;
+			}
+
+			void Clear() noexcept
+			{
+				for (MessageHeader* message = Head; message; )
+				{
+					MessageHeader* next = message->Next;
+					message->Destroy(message);
+					message = next;
+				}
+				Reset();
+			}
+		};
+
+	private:
+		std::thread::id    m_owner;
+		mutable std::mutex m_mutex;
+		MessageBuffer      m_incoming;    // Guarded by m_mutex
+		MessageBuffer      m_processing;  // Owner thread only
+		u32                m_pumpDepth = 0;  // Owner thread only
+		MailboxStats       m_stats;       // Guarded by m_mutex
+	};
+
+	// Runs the calling thread's pending queued slot calls
+	inline u64 PumpMailbox()
+	{
+		return Mailbox::ForCurrentThread()->Pump();
+	}
+}
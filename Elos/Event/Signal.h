@@ -1,120 +1,588 @@
 #pragma once
 #include <Elos/Common/StandardTypes.h>
 #include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/InplaceFunction.h>
+#include <Elos/Event/Mailbox.h>
+#include <Elos/Event/SignalInstrumentation.h>
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <ranges>
 
 namespace Elos
 {
 	template <typename... Args> class Connection;
 
 	template <typename F, typename... Args>
-	concept Invocable = requires(F f, Args... args) 
+	concept Invocable = requires(F f, Args... args)
 	{
 		{ std::invoke(f, args...) };
 	};
 
+	namespace Internal
+	{
+		// Inline capacity of slot callables. Large enough to wrap an std::function (64 bytes on MSVC)
+		// for callers that still hand one over
+		inline constexpr u64 SlotCapacity = 64;
+
+		template <typename Signature>
+		using SlotFunction = InplaceFunction<Signature, SlotCapacity>;
+
+		// Slot body of a queued connection, shared with the mailbox messages posted for it
+		template <typename... Args>
+		class QueuedSlot final : public QueuedTargetBase
+		{
+		public:
+			explicit QueuedSlot(SlotFunction<void(Args...)> function)
+				: Function(std::move(function))
+			{
+			}
+
+			// Called by the mailbox with its stored copies of the arguments
+			void operator()(std::decay_t<Args>&... values) const
+			{
+				Function(static_cast<Args&&>(values)...);
+			}
+
+			SlotFunction<void(Args...)> Function;
+		};
+
+		// Single-argument signals can be emitted over a span of payloads (EmitRange) and accept slots
+		// taking the whole span at once
+		template <typename... Args>
+		struct SignalBatchTraits
+		{
+			static constexpr bool Enabled = false;
+			struct Payload {};
+			struct BatchFunction {};
+		};
+
+		template <typename Arg>
+		struct SignalBatchTraits<Arg>
+		{
+			static constexpr bool Enabled = true;
+			using Payload       = std::remove_cvref_t<Arg>;
+			using BatchFunction = SlotFunction<void(std::span<const Payload>)>;
+		};
+
+		// Wraps a callable so that calls made off the mailbox's thread are posted to it instead
+		template <typename... Args, typename Callable>
+		NODISCARD auto MakeQueuedSlot(Callable&& callable, std::shared_ptr<Mailbox> mailbox)
+		{
+			auto target = std::make_shared<QueuedSlot<Args...>>(std::forward<Callable>(callable));
+			auto forwarder = [target, mailbox = std::move(mailbox)](Args... args)
+			{
+				if (mailbox->IsOwnerThread())
+				{
+					target->Function(std::forward<Args>(args)...);
+				}
+				else
+				{
+					mailbox->Post(target, std::forward<Args>(args)...);
+				}
+			};
+
+			return std::make_pair(std::move(forwarder), std::move(target));
+		}
+	}
+
+	/**
+	 * @brief Single-threaded signal with contiguous slot storage
+	 *
+	 * Slots live in a dense array (in connection order) addressed through a generational slot map,
+	 * so connection ids stay valid while the dense array is compacted and stale ids are rejected.
+	 * Disconnecting leaves a tombstone (O(1)); tombstones are compacted once no emission is running,
+	 * which makes connecting/disconnecting from inside a slot safe.
+	 *
+	 * Slots may be connected with a target Mailbox: emitting from any other thread then posts the call
+	 * to that mailbox and it runs on the target thread's next Pump(). The slot list itself is still
+	 * single-threaded, use ConcurrentSignal when connecting and emitting from different threads.
+	 *
+	 * Single-argument signals also support EmitRange, which walks the slots once and hands each slot
+	 * the whole batch while it is hot. Slots taking std::span<const T> receive the batch in one call.
+	 *
+	 * With ELOS_SIGNAL_INSTRUMENTATION every slot call is timed into SlotStats and the signal is listed
+	 * in SignalRegistry under the name given to the constructor.
+	 */
 	template <typename... Args>
 	class Signal
 	{
 		friend class Connection<Args...>;
 
 	public:
-		using SlotFunction = std::function<void(Args...)>;
-		using ConnectionId = u32;
+		using SlotFunction  = Internal::SlotFunction<void(Args...)>;
+		using ConnectionId  = u64;  // (generation << 32) | slot map index, 0 is never a valid id
+		using BatchTraits   = Internal::SignalBatchTraits<Args...>;
+		using BatchFunction = typename BatchTraits::BatchFunction;
 
 		Signal() = default;
+
+		// The name identifies the signal in SignalRegistry reports, it is unused without instrumentation
+		explicit Signal(MAYBE_UNUSED std::string_view name)
+#if ELOS_SIGNAL_INSTRUMENTATION
+			: m_registration(this, &Signal::CollectStats, name)
+#endif
+		{
+		}
+
 		~Signal() = default;
-		Signal(Signal&&) noexcept = default;
 		Signal(const Signal&) = delete;
-		Signal& operator=(Signal&&) noexcept = default;
 		Signal& operator=(const Signal&) = delete;
 
+		Signal(Signal&& other) noexcept
+			: m_slots(std::move(other.m_slots))
+			, m_pendingSlots(std::move(other.m_pendingSlots))
+			, m_entries(std::move(other.m_entries))
+			, m_freeEntries(std::move(other.m_freeEntries))
+			, m_anchor(std::move(other.m_anchor))
+			, m_liveCount(std::exchange(other.m_liveCount, 0))
+			, m_tombstones(std::exchange(other.m_tombstones, 0))
+			, m_deferredTombstones(std::exchange(other.m_deferredTombstones, 0))
+#if ELOS_SIGNAL_INSTRUMENTATION
+			, m_registration(std::move(other.m_registration), this)
+#endif
+		{
+			if (m_anchor)
+			{
+				*m_anchor = this;
+			}
+		}
+
+		Signal& operator=(Signal&& other) noexcept
+		{
+			if (this != &other)
+			{
+				m_slots              = std::move(other.m_slots);
+				m_pendingSlots       = std::move(other.m_pendingSlots);
+				m_entries            = std::move(other.m_entries);
+				m_freeEntries        = std::move(other.m_freeEntries);
+				m_anchor             = std::move(other.m_anchor);
+				m_liveCount          = std::exchange(other.m_liveCount, 0);
+				m_tombstones         = std::exchange(other.m_tombstones, 0);
+				m_deferredTombstones = std::exchange(other.m_deferredTombstones, 0);
+#if ELOS_SIGNAL_INSTRUMENTATION
+				m_registration.Assign(std::move(other.m_registration), this);
+#endif
+
+				if (m_anchor)
+				{
+					*m_anchor = this;
+				}
+			}
+			return *this;
+		}
+
 		template <Invocable<Args...> Callable>
 		NODISCARD Connection<Args...> Connect(Callable&& callable)
 		{
-			static ConnectionId nextId = 0;
-			ConnectionId id = ++nextId;
+			return Insert(SlotFunction(std::forward<Callable>(callable)), BatchFunction{});
+		}
 
-			std::shared_ptr<SlotInfo> info = std::make_shared<SlotInfo>();
-			info->Id = id;
-			info->Function = std::forward<Callable>(callable);
+		// Batch slot: takes std::span<const T> and receives EmitRange batches in a single call
+		template <typename Callable>
+			requires (BatchTraits::Enabled && !Invocable<Callable, Args...> && std::is_invocable_v<Callable&, std::span<const typename BatchTraits::Payload>>)
+		NODISCARD Connection<Args...> Connect(Callable&& callable)
+		{
+			return Insert(SlotFunction{}, BatchFunction(std::forward<Callable>(callable)));
+		}
 
-			m_slots.push_back(info);
+		// Queued connection: runs the callable on the mailbox's thread, posting to it when emitted elsewhere
+		template <Invocable<Args...> Callable>
+		NODISCARD Connection<Args...> Connect(Callable&& callable, std::shared_ptr<Mailbox> mailbox)
+		{
+			auto [forwarder, target] = Internal::MakeQueuedSlot<Args...>(std::forward<Callable>(callable), std::move(mailbox));
 
-			return Connection<Args...>(std::move(info), this);
+			Connection<Args...> connection = Connect(std::move(forwarder));
+			FindSlot(connection.Id())->Queued = std::move(target);
+			return connection;
 		}
 
 		NODISCARD bool Disconnect(ConnectionId id)
 		{
-			auto it = std::ranges::find_if(m_slots, [id](const auto& slot) 
+			Slot* slot = FindSlot(id);
+			if (!slot)
 			{
-				return slot->Id == id;
-			});
+				return false;
+			}
+
+			Kill(*slot);
 
-			if (it != m_slots.end())
+			if (!IsEmitting())
 			{
-				(*it)->ParentSignal = nullptr;
-				m_slots.erase(it);
-				return true;
+				CompactIfNeeded();
 			}
-			return false;
+			return true;
 		}
 
 		void DisconnectAll() noexcept
 		{
-			for (auto& slot : m_slots)
+			for (Slot& slot : m_slots)
+			{
+				if (slot.Alive)
+				{
+					Kill(slot);
+				}
+			}
+
+			for (Slot& slot : m_pendingSlots)
 			{
-				slot->ParentSignal = nullptr;
+				if (slot.Alive)
+				{
+					Kill(slot);
+				}
+			}
+
+			if (!IsEmitting())
+			{
+				Maintain();
 			}
-			m_slots.clear();
 		}
 
 		void Emit(Args... args) const
 		{
-			for (const auto& slot : m_slots)
+			EmitScope scope(*this);
+
+			// Slots connected by this emission land in m_pendingSlots, so the count is fixed up front
+			const u64 count = m_slots.size();
+			for (u64 i = 0; i < count; ++i)
+			{
+				const Slot& slot = m_slots[i];
+				if (slot.Alive) LIKELY
+				{
+					Invoke(slot, args...);
+				}
+			}
+		}
+
+		// Emits every payload in order, slot-major: each slot processes the whole batch before the next
+		// slot runs. Ordering between slots differs from calling Emit per payload, ordering per slot does not
+		void EmitRange(std::span<const typename BatchTraits::Payload> payloads) const requires (BatchTraits::Enabled)
+		{
+			if (payloads.empty())
 			{
-				slot->Function(args...);
+				return;
+			}
+
+			EmitScope scope(*this);
+
+			const u64 count = m_slots.size();
+			for (u64 i = 0; i < count; ++i)
+			{
+				const Slot& slot = m_slots[i];
+				if (!slot.Alive)
+				{
+					continue;
+				}
+
+				if (slot.Batch)
+				{
+					Timed(slot, [&]() { slot.Batch(payloads); });
+					continue;
+				}
+
+				for (const auto& payload : payloads)
+				{
+					// The slot may disconnect itself part-way through the batch
+					if (!slot.Alive) UNLIKELY
+					{
+						break;
+					}
+					Timed(slot, [&]() { slot.Function(payload); });
+				}
 			}
 		}
 
-		NODISCARD u64 ConnectionCount() const noexcept { return m_slots.size(); }
-		NODISCARD bool HasConnections() const noexcept { return !m_slots.empty();}
+		NODISCARD bool IsConnected(ConnectionId id) const noexcept { return FindSlot(id) != nullptr; }
+		NODISCARD u64 ConnectionCount() const noexcept { return m_liveCount; }
+		NODISCARD bool HasConnections() const noexcept { return m_liveCount != 0; }
 
 		void operator()(Args... args) const
 		{
 			Emit(std::forward<Args>(args)...);
 		}
 
+#if ELOS_SIGNAL_INSTRUMENTATION
+		NODISCARD SlotStats GetSlotStats(ConnectionId id) const noexcept
+		{
+			const Slot* slot = FindSlot(id);
+			return slot ? slot->Stats : SlotStats{};
+		}
+#endif
+
 	private:
-		struct SlotInfo
+		struct Slot
+		{
+			SlotFunction                                Function;  // Empty for batch slots
+			u32                                         Entry;     // Index into m_entries
+			bool                                        Alive;
+			BatchFunction                               Batch;     // Set for batch slots
+			std::shared_ptr<Internal::QueuedTargetBase> Queued = nullptr;  // Set for queued connections
+#if ELOS_SIGNAL_INSTRUMENTATION
+			mutable SlotStats                           Stats{};
+#endif
+		};
+
+		struct SlotEntry
 		{
-			ConnectionId Id;
-			SlotFunction Function;
-			Signal<Args...>* ParentSignal = nullptr;
+			u32 Dense;       // Index into m_slots (or m_pendingSlots past the end of m_slots)
+			u32 Generation;
+		};
+
+		// Keeps the emission depth balanced even if a slot throws
+		struct EmitScope
+		{
+			explicit EmitScope(const Signal& signal) : Owner(signal) { ++Owner.m_emitDepth; }
+			~EmitScope()
+			{
+				if (--Owner.m_emitDepth == 0)
+				{
+					Owner.Maintain();
+				}
+			}
+
+			const Signal& Owner;
 		};
 
-		std::vector<std::shared_ptr<SlotInfo>> m_slots;
+		static constexpr u32 InvalidIndex = ~0u;
+
+		static constexpr ConnectionId MakeId(u32 index, u32 generation) noexcept
+		{
+			return (static_cast<u64>(generation) << 32) | index;
+		}
+
+		NODISCARD bool IsEmitting() const noexcept { return m_emitDepth != 0; }
+
+		NODISCARD Connection<Args...> Insert(SlotFunction function, BatchFunction batch)
+		{
+			const u32 index = AcquireEntry();
+			SlotEntry& entry = m_entries[index];
+
+			// Slots connected during an emission are parked until it finishes so the dense array never reallocates under a running slot
+			entry.Dense = static_cast<u32>(m_slots.size() + m_pendingSlots.size());
+			(IsEmitting() ? m_pendingSlots : m_slots).push_back(Slot
+			{
+				.Function = std::move(function),
+				.Entry    = index,
+				.Alive    = true,
+				.Batch    = std::move(batch)
+			});
+
+			++m_liveCount;
+
+			if (!m_anchor)
+			{
+				m_anchor = std::make_shared<Signal*>(this);
+			}
+
+			return Connection<Args...>(m_anchor, MakeId(index, entry.Generation));
+		}
+
+		static void Invoke(const Slot& slot, Args&... args)
+		{
+			if constexpr (BatchTraits::Enabled)
+			{
+				if (!slot.Function) UNLIKELY
+				{
+					Timed(slot, [&]() { slot.Batch(std::span<const typename BatchTraits::Payload>(&args..., 1)); });
+					return;
+				}
+			}
+
+			Timed(slot, [&]() { slot.Function(args...); });
+		}
+
+		template <typename Call>
+		static void Timed(MAYBE_UNUSED const Slot& slot, Call&& call)
+		{
+#if ELOS_SIGNAL_INSTRUMENTATION
+			const Timer::TimePoint start = Timer::Now();
+			call();
+			slot.Stats.Record(start, Timer::Now());
+#else
+			call();
+#endif
+		}
+
+#if ELOS_SIGNAL_INSTRUMENTATION
+		static void CollectStats(const void* owner, const std::string& name, std::vector<SlotReport>& out)
+		{
+			const Signal& signal = *static_cast<const Signal*>(owner);
+			for (const std::vector<Slot>* slots : { &signal.m_slots, &signal.m_pendingSlots })
+			{
+				for (const Slot& slot : *slots)
+				{
+					if (slot.Alive)
+					{
+						out.push_back(SlotReport
+						{
+							.Signal     = name,
+							.Connection = MakeId(slot.Entry, signal.m_entries[slot.Entry].Generation),
+							.Stats      = slot.Stats
+						});
+					}
+				}
+			}
+		}
+#endif
+
+		NODISCARD u32 AcquireEntry()
+		{
+			if (!m_freeEntries.empty())
+			{
+				const u32 index = m_freeEntries.back();
+				m_freeEntries.pop_back();
+				return index;
+			}
+
+			m_entries.push_back(SlotEntry{ .Dense = InvalidIndex, .Generation = 1 });
+			return static_cast<u32>(m_entries.size() - 1);
+		}
+
+		NODISCARD Slot* FindSlot(ConnectionId id) const noexcept
+		{
+			const u32 index      = static_cast<u32>(id);
+			const u32 generation = static_cast<u32>(id >> 32);
+
+			if (index >= m_entries.size())
+			{
+				return nullptr;
+			}
+
+			const SlotEntry& entry = m_entries[index];
+			if (entry.Generation != generation || entry.Dense == InvalidIndex)
+			{
+				return nullptr;
+			}
+
+			Slot& slot = entry.Dense < m_slots.size()
+				? m_slots[entry.Dense]
+				: m_pendingSlots[entry.Dense - m_slots.size()];
+
+			return slot.Alive ? &slot : nullptr;
+		}
+
+		// Tombstones the slot and retires its id. The callable itself is only destroyed outside of
+		// an emission since it may be the one currently executing
+		void Kill(Slot& slot) noexcept
+		{
+			SlotEntry& entry = m_entries[slot.Entry];
+			entry.Dense = InvalidIndex;
+			if (++entry.Generation == 0)
+			{
+				entry.Generation = 1;
+			}
+			m_freeEntries.push_back(slot.Entry);
+
+			slot.Alive = false;
+			--m_liveCount;
+
+			// Drop calls already posted to the target thread
+			if (slot.Queued)
+			{
+				slot.Queued->Revoke();
+			}
+			++m_tombstones;
+
+			if (IsEmitting())
+			{
+				++m_deferredTombstones;
+			}
+			else
+			{
+				slot.Function = nullptr;
+				slot.Batch    = BatchFunction{};
+			}
+		}
+
+		// Runs once the outermost emission returns
+		void Maintain() const
+		{
+			if (!m_pendingSlots.empty())
+			{
+				m_slots.insert(m_slots.end(),
+					std::make_move_iterator(m_pendingSlots.begin()),
+					std::make_move_iterator(m_pendingSlots.end()));
+				m_pendingSlots.clear();
+			}
+
+			if (m_deferredTombstones != 0)
+			{
+				Compact();
+			}
+			else
+			{
+				CompactIfNeeded();
+			}
+		}
+
+		void CompactIfNeeded() const
+		{
+			// Amortizes the O(n) pass over at least n/2 disconnects
+			if (m_tombstones != 0 && m_tombstones * 2 >= m_slots.size())
+			{
+				Compact();
+			}
+		}
+
+		// Stable removal of tombstones, preserving emission order
+		void Compact() const
+		{
+			u32 write = 0;
+			for (u32 read = 0; read < m_slots.size(); ++read)
+			{
+				if (!m_slots[read].Alive)
+				{
+					continue;
+				}
+
+				if (write != read)
+				{
+					m_slots[write] = std::move(m_slots[read]);
+				}
+
+				m_entries[m_slots[write].Entry].Dense = write;
+				++write;
+			}
+
+			m_slots.erase(m_slots.begin() + write, m_slots.end());
+			m_tombstones         = 0;
+			m_deferredTombstones = 0;
+		}
+
+	private:
+		// Storage is mutable since maintenance deferred by a (const) emission runs when it completes
+		mutable std::vector<Slot>      m_slots;
+		mutable std::vector<Slot>      m_pendingSlots;
+		mutable std::vector<SlotEntry> m_entries;
+		std::vector<u32>               m_freeEntries;
+		std::shared_ptr<Signal*>       m_anchor;  // Lets connections detect that the signal moved or died
+		u64                            m_liveCount          = 0;
+		mutable u64                    m_tombstones         = 0;
+		mutable u64                    m_deferredTombstones = 0;
+		mutable u32                    m_emitDepth          = 0;
+#if ELOS_SIGNAL_INSTRUMENTATION
+		Internal::SignalRegistration   m_registration{ this, &Signal::CollectStats, {} };
+#endif
 	};
 
 	template <typename... Args>
 	class Connection
 	{
 	public:
+		using ConnectionId = typename Signal<Args...>::ConnectionId;
+
 		Connection() = default;
-		
-		Connection(std::shared_ptr<typename Signal<Args...>::SlotInfo> slotInfo, Signal<Args...>* signal)
-			: m_slotInfo(std::move(slotInfo))
+
+		Connection(std::weak_ptr<Signal<Args...>*> signal, ConnectionId id)
+			: m_signal(std::move(signal))
+			, m_id(id)
 		{
-			if (m_slotInfo)
-			{
-				m_slotInfo->ParentSignal = signal;
-			}
 		}
-		
+
 		Connection(Connection&&) noexcept = default;
 		Connection(const Connection&) = default;
 		~Connection() = default;
@@ -123,30 +591,36 @@ namespace Elos
 
 		bool Disconnect()
 		{
-			if (m_slotInfo && m_slotInfo->ParentSignal)
-			{
-				auto* signal = m_slotInfo->ParentSignal;
-				auto id = m_slotInfo->Id;
+			const std::shared_ptr<Signal<Args...>*> anchor = m_signal.lock();
+			const ConnectionId id = std::exchange(m_id, 0);
+			m_signal.reset();
 
-				m_slotInfo->ParentSignal = nullptr;
-				m_slotInfo.reset();
-				return signal->Disconnect(id);
-			}
-			return false;
+			return anchor && *anchor && (*anchor)->Disconnect(id);
 		}
 
 		NODISCARD bool IsConnected() const noexcept
 		{
-			return m_slotInfo && m_slotInfo->ParentSignal;
+			const std::shared_ptr<Signal<Args...>*> anchor = m_signal.lock();
+			return anchor && *anchor && (*anchor)->IsConnected(m_id);
 		}
 
 		NODISCARD auto Id() const noexcept
 		{
-			return m_slotInfo ? m_slotInfo->Id : 0;
+			return m_id;
 		}
 
+#if ELOS_SIGNAL_INSTRUMENTATION
+		// Timings of this slot so far, zeroed once disconnected
+		NODISCARD SlotStats GetStats() const noexcept
+		{
+			const std::shared_ptr<Signal<Args...>*> anchor = m_signal.lock();
+			return anchor && *anchor ? (*anchor)->GetSlotStats(m_id) : SlotStats{};
+		}
+#endif
+
 	private:
-		std::shared_ptr<typename Signal<Args...>::SlotInfo> m_slotInfo;
+		std::weak_ptr<Signal<Args...>*> m_signal;
+		ConnectionId                    m_id = 0;
 	};
 
 	template <typename... Args>
@@ -159,8 +633,8 @@ namespace Elos
 			: Connection<Args...>(std::move(conn)) {}
 		ScopedConnection(ScopedConnection&&) noexcept = default;
 		ScopedConnection(const ScopedConnection&) = delete;
-		
-		~ScopedConnection() 
+
+		~ScopedConnection()
 		{
 			this->Disconnect();
 		}
@@ -168,4 +642,4 @@ namespace Elos
 		ScopedConnection& operator=(ScopedConnection&&) noexcept = default;
 		ScopedConnection& operator=(const ScopedConnection&) = delete;
 	};
-} 
\ No newline at end of file
+}
@@ -0,0 +1,215 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Utils/Timer.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Enabled through the SignalInstrumentation build option. When 0, Signal carries no instrumentation
+// state and emission takes no timestamps
+#if !defined(ELOS_SIGNAL_INSTRUMENTATION)
+	#define ELOS_SIGNAL_INSTRUMENTATION 0
+#endif
+
+namespace Elos
+{
+	struct SlotStats
+	{
+		// Bucket i counts calls that took [2^(i-1), 2^i) nanoseconds, the last bucket also takes everything slower
+		static constexpr u32 BucketCount = 32;
+
+		u64                          Calls   = 0;
+		f64                          TotalMs = 0.0;
+		f64                          MaxMs   = 0.0;
+		std::array<u64, BucketCount> Histogram{};
+
+		void Record(Timer::TimePoint start, Timer::TimePoint end) noexcept
+		{
+			const f64 ms = Timer::DurationInMilliseconds(start, end);
+			const u64 ns = static_cast<u64>(ms * 1'000'000.0);
+
+			++Calls;
+			TotalMs += ms;
+			MaxMs    = std::max(MaxMs, ms);
+			++Histogram[std::min<u64>(std::bit_width(ns), BucketCount - 1)];
+		}
+
+		NODISCARD f64 AverageMs() const noexcept { return Calls ? TotalMs / static_cast<f64>(Calls) : 0.0; }
+
+		// Exclusive upper bound of a bucket, in nanoseconds
+		NODISCARD static constexpr u64 BucketLimitNs(u32 bucket) noexcept { return u64{ 1 } << bucket; }
+	};
+
+	struct SlotReport
+	{
+		std::string Signal;
+		u64         Connection;  // Signal<...>::ConnectionId of the slot
+		SlotStats   Stats;
+	};
+
+	namespace Internal
+	{
+		struct SignalRecord
+		{
+			std::string Name;
+			const void* Owner;
+			void (*Collect)(const void* owner, const std::string& name, std::vector<SlotReport>& out);
+		};
+	}
+
+	/**
+	 * @brief Process-wide list of live instrumented signals
+	 *
+	 * Signals register themselves on construction when ELOS_SIGNAL_INSTRUMENTATION is enabled.
+	 * Collecting reads the per-slot counters without synchronization, so call it from the thread
+	 * that emits the signals (normally the main thread, between frames).
+	 */
+	class SignalRegistry
+	{
+	public:
+		NODISCARD static SignalRegistry& Get()
+		{
+			static SignalRegistry s_registry;
+			return s_registry;
+		}
+
+		void Register(const Internal::SignalRecord* record)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_records.push_back(record);
+		}
+
+		void Unregister(const Internal::SignalRecord* record)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			std::erase(m_records, record);
+		}
+
+		NODISCARD std::vector<std::string> GetSignalNames() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			std::vector<std::string> names;
+			names.reserve(m_records.size());
+			for (const Internal::SignalRecord* record : m_records)
+			{
+				names.push_back(record->Name);
+			}
+			return names;
+		}
+
+		// One report per connected slot of every live signal
+		NODISCARD std::vector<SlotReport> Collect() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			std::vector<SlotReport> reports;
+			for (const Internal::SignalRecord* record : m_records)
+			{
+				record->Collect(record->Owner, record->Name, reports);
+			}
+			return reports;
+		}
+
+		// Slots with the highest cumulative time
+		NODISCARD std::vector<SlotReport> GetTopOffenders(u64 count) const
+		{
+			std::vector<SlotReport> reports = Collect();
+			const u64 kept = std::min<u64>(count, reports.size());
+
+			std::partial_sort(reports.begin(), reports.begin() + kept, reports.end(),
+				[](const SlotReport& a, const SlotReport& b) { return a.Stats.TotalMs > b.Stats.TotalMs; });
+			reports.resize(kept);
+			return reports;
+		}
+
+		void DumpTopOffenders(u64 count) const
+		{
+			std::println("{:<32} {:>18} {:>10} {:>12} {:>10} {:>10}", "Signal", "Connection", "Calls", "Total (ms)", "Avg (us)", "Max (us)");
+			for (const SlotReport& report : GetTopOffenders(count))
+			{
+				std::println("{:<32} {:>18x} {:>10} {:>12.3f} {:>10.2f} {:>10.2f}",
+					report.Signal, report.Connection, report.Stats.Calls, report.Stats.TotalMs,
+					report.Stats.AverageMs() * 1000.0, report.Stats.MaxMs * 1000.0);
+			}
+		}
+
+	private:
+		SignalRegistry() = default;
+
+	private:
+		mutable std::mutex                         m_mutex;
+		std::vector<const Internal::SignalRecord*> m_records;
+	};
+
+	namespace Internal
+	{
+		// Keeps a signal registered for its lifetime. The record lives on the heap so the registry's
+		// pointer survives moves of the signal; the new owner rebinds it
+		class SignalRegistration
+		{
+		public:
+			using CollectFunction = void (*)(const void*, const std::string&, std::vector<SlotReport>&);
+
+			SignalRegistration(const void* owner, CollectFunction collect, std::string_view name)
+				: m_record(std::make_unique<SignalRecord>(SignalRecord
+				{
+					.Name    = name.empty() ? std::string("(unnamed)") : std::string(name),
+					.Owner   = owner,
+					.Collect = collect
+				}))
+			{
+				SignalRegistry::Get().Register(m_record.get());
+			}
+
+			~SignalRegistration()
+			{
+				Reset();
+			}
+
+			SignalRegistration(const SignalRegistration&) = delete;
+			SignalRegistration& operator=(const SignalRegistration&) = delete;
+
+			SignalRegistration(SignalRegistration&& other, const void* owner) noexcept
+				: m_record(std::move(other.m_record))
+			{
+				Rebind(owner);
+			}
+
+			void Assign(SignalRegistration&& other, const void* owner) noexcept
+			{
+				Reset();
+				m_record = std::move(other.m_record);
+				Rebind(owner);
+			}
+
+		private:
+			void Rebind(const void* owner) noexcept
+			{
+				if (m_record)
+				{
+					m_record->Owner = owner;
+				}
+			}
+
+			void Reset()
+			{
+				if (m_record)
+				{
+					SignalRegistry::Get().Unregister(m_record.get());
+					m_record.reset();
+				}
+			}
+
+		private:
+			std::unique_ptr<SignalRecord> m_record;
+		};
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <array>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Elos
+{
+	namespace Internal
+	{
+		// Free functions, static member functions and constexpr function objects need no instance
+		template <auto Slot>
+		struct StaticSlotTraits
+		{
+			using Instance = std::nullptr_t;
+		};
+
+		template <typename Class, typename Return, typename... Params, Return (Class::*Method)(Params...)>
+		struct StaticSlotTraits<Method>
+		{
+			using Instance = Class*;
+		};
+
+		template <typename Class, typename Return, typename... Params, Return (Class::*Method)(Params...) const>
+		struct StaticSlotTraits<Method>
+		{
+			using Instance = const Class*;
+		};
+
+		template <typename Class, typename Return, typename... Params, Return (Class::*Method)(Params...) noexcept>
+		struct StaticSlotTraits<Method>
+		{
+			using Instance = Class*;
+		};
+
+		template <typename Class, typename Return, typename... Params, Return (Class::*Method)(Params...) const noexcept>
+		struct StaticSlotTraits<Method>
+		{
+			using Instance = const Class*;
+		};
+
+		template <auto Slot>
+		inline constexpr bool IsMemberSlot = !std::is_same_v<typename StaticSlotTraits<Slot>::Instance, std::nullptr_t>;
+	}
+
+	/**
+	 * @brief Signal whose slots are fixed at compile time
+	 *
+	 * Emit is a folded sequence of direct calls, there is no std::function, shared_ptr or slot array.
+	 * Slots are free/static functions, constexpr function objects, or member functions; instances for
+	 * member slots are passed to the constructor in slot order.
+	 *
+	 *     StaticSignal<&Renderer::OnResized, &LogResize, &Audio::OnResized> onResized(renderer, audio);
+	 *     onResized.Emit(event);
+	 *
+	 * Emit/operator()/ConnectionCount/HasConnections/DisconnectAll mirror Signal so a hot signal can be
+	 * switched over without touching its emitters.
+	 */
+	template <auto... Slots>
+	class StaticSignal
+	{
+	public:
+		static constexpr u64 MemberSlotCount = (u64{ 0 } + ... + (Internal::IsMemberSlot<Slots> ? 1 : 0));
+
+		constexpr StaticSignal() requires (MemberSlotCount == 0) = default;
+
+		template <typename... Objects>
+			requires (sizeof...(Objects) == MemberSlotCount && MemberSlotCount != 0)
+		constexpr explicit StaticSignal(Objects&... objects)
+		{
+			BindInstances(std::tuple<Objects*...>(&objects...), std::make_index_sequence<sizeof...(Slots)>{});
+		}
+
+		template <typename... Args>
+		constexpr void Emit(Args&&... args) const
+		{
+			EmitImpl(std::make_index_sequence<sizeof...(Slots)>{}, args...);
+		}
+
+		template <typename... Args>
+		constexpr void operator()(Args&&... args) const
+		{
+			Emit(std::forward<Args>(args)...);
+		}
+
+		NODISCARD static constexpr u64 ConnectionCount() noexcept { return sizeof...(Slots); }
+		NODISCARD static constexpr bool HasConnections() noexcept { return sizeof...(Slots) != 0; }
+
+		// Slots are fixed, present so StaticSignal can stand in for Signal in aggregates such as WindowEventSignals
+		static constexpr void DisconnectAll() noexcept {}
+
+	private:
+		// Position of each member slot's instance among the constructor arguments
+		static constexpr std::array<u64, sizeof...(Slots)> InstanceOrdinals = []()
+		{
+			constexpr std::array<bool, sizeof...(Slots)> isMember{ Internal::IsMemberSlot<Slots>... };
+
+			std::array<u64, sizeof...(Slots)> ordinals{};
+			u64 next = 0;
+			for (u64 i = 0; i < isMember.size(); ++i)
+			{
+				ordinals[i] = isMember[i] ? next++ : 0;
+			}
+			return ordinals;
+		}();
+
+		template <typename ObjectTuple, size_t... I>
+		constexpr void BindInstances(const ObjectTuple& objects, std::index_sequence<I...>)
+		{
+			((BindInstance<Slots, I>(objects)), ...);
+		}
+
+		template <auto Slot, size_t I, typename ObjectTuple>
+		constexpr void BindInstance(const ObjectTuple& objects)
+		{
+			if constexpr (Internal::IsMemberSlot<Slot>)
+			{
+				std::get<I>(m_instances) = std::get<InstanceOrdinals[I]>(objects);
+			}
+		}
+
+		template <size_t... I, typename... Args>
+		constexpr void EmitImpl(std::index_sequence<I...>, Args&... args) const
+		{
+			(InvokeSlot<Slots>(std::get<I>(m_instances), args...), ...);
+		}
+
+		template <auto Slot, typename Instance, typename... Args>
+		static constexpr void InvokeSlot(Instance instance, Args&... args)
+		{
+			if constexpr (Internal::IsMemberSlot<Slot>)
+			{
+				(instance->*Slot)(args...);
+			}
+			else
+			{
+				std::invoke(Slot, args...);
+			}
+		}
+
+	private:
+		std::tuple<typename Internal::StaticSlotTraits<Slots>::Instance...> m_instances{};
+	};
+}
@@ -1,11 +1,11 @@
 #pragma once
 #include <Elos/Common/StandardTypes.h>
 #include <Elos/Common/String.h>
+#include <Elos/Common/InplaceFunction.h>
 #include <unordered_map>
 #include <any>
 #include <memory>
 #include <type_traits>
-#include <functional>
 
 namespace Elos
 {
@@ -17,8 +17,8 @@ namespace Elos
 	struct Function
 	{
 		String Name;
-		std::function<std::any(void*, const std::vector<std::any>&)> Invoke;
-		std::function<bool(void*)> Callable = [](void*) -> bool { return true; };
+		InplaceFunction<std::any(void*, const std::vector<std::any>&)> Invoke;
+		InplaceFunction<bool(void*)> Callable = [](void*) -> bool { return true; };
 		std::vector<String> ParamTypes;
 		String ReturnType;
 	};
@@ -27,8 +27,8 @@ namespace Elos
 	{
 		String Name;
 		String Type;
-		std::function<std::any(void*)> Getter;
-		std::function<void(void*, const std::any&)> Setter;
+		InplaceFunction<std::any(void*)> Getter;
+		InplaceFunction<void(void*, const std::any&)> Setter;
 		bool IsReadOnly = false;
 
 		// Helper for getting property value
@@ -139,7 +139,7 @@ namespace Elos
 			return m_classBuilder;
 		}
 
-		ClassBuilder<Class>& IsCallable(std::function<bool(void*)> condition)
+		ClassBuilder<Class>& IsCallable(InplaceFunction<bool(void*)> condition)
 		{
 			m_function.Callable = std::move(condition);
 			return m_classBuilder;
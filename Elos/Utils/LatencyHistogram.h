@@ -0,0 +1,58 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+
+namespace Elos
+{
+	/**
+	 * @brief Power-of-two histogram of durations, with the same buckets as QueueStats
+	 *
+	 * Not synchronized: owners record under their own lock and hand out copies.
+	 */
+	struct LatencyHistogram
+	{
+		// Bucket i counts samples of [2^(i-1), 2^i) nanoseconds, the last bucket also takes everything slower
+		static constexpr u32 BucketCount = 32;
+
+		u64                          Count   = 0;
+		f64                          TotalMs = 0.0;
+		f64                          MaxMs   = 0.0;
+		std::array<u64, BucketCount> Buckets{};
+
+		void Record(std::chrono::nanoseconds duration) noexcept
+		{
+			const auto ns = static_cast<u64>(std::max<i64>(0, duration.count()));
+			const f64 ms = static_cast<f64>(ns) / 1'000'000.0;
+
+			++Count;
+			TotalMs += ms;
+			MaxMs    = std::max(MaxMs, ms);
+			++Buckets[std::min<u64>(std::bit_width(ns), BucketCount - 1)];
+		}
+
+		NODISCARD f64 AverageMs() const noexcept { return Count ? TotalMs / static_cast<f64>(Count) : 0.0; }
+
+		// Upper bound of the bucket holding the given fraction of samples, e.g. 0.99 for p99
+		NODISCARD u64 PercentileNs(f64 fraction) const noexcept
+		{
+			const u64 target = static_cast<u64>(fraction * static_cast<f64>(Count));
+			u64 seen = 0;
+			for (u32 bucket = 0; bucket < BucketCount; ++bucket)
+			{
+				seen += Buckets[bucket];
+				if (seen > target || seen == Count)
+				{
+					return BucketLimitNs(bucket);
+				}
+			}
+			return BucketLimitNs(BucketCount - 1);
+		}
+
+		// Exclusive upper bound of a bucket, in nanoseconds
+		NODISCARD static constexpr u64 BucketLimitNs(u32 bucket) noexcept { return u64{ 1 } << bucket; }
+	};
+}
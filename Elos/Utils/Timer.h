@@ -1,8 +1,9 @@
 #pragma once
 #include <Elos/Common/StandardTypes.h>
 #include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/FunctionRef.h>
+#include <Elos/Common/InplaceFunction.h>
 #include <chrono>
-#include <functional>
 #include <limits>
 
 namespace Elos
@@ -24,7 +25,7 @@ namespace Elos
 		using ClockType    = std::chrono::high_resolution_clock;
 		using TimePoint    = ClockType::time_point;
 		using Duration     = std::chrono::duration<f64>;
-		using TickFunction = std::function<void(const TimeInfo&)>;
+		using TickFunction = FunctionRef<void(const TimeInfo&)>;  // Only called during Tick, never stored
 
 	public:
 		Timer(const bool startPaused = false, const f64 targetFPS = -1)
@@ -132,7 +133,7 @@ namespace Elos
 		// Process one frame of the game loop
 		// For variable timestep, update is called once with the actual elapsed time
 		// For fixed timestep, update may be called multiple times with fixed intervals
-		void Tick(const TickFunction& tickFunc)
+		void Tick(TickFunction tickFunc)
 		{
 			if (m_isPaused)
 			{
@@ -215,7 +216,7 @@ namespace Elos
 	class ScopedTimer
 	{
 	public:
-		using TimeInfoCallback = std::function<void(const Timer::TimeInfo&)>;
+		using TimeInfoCallback = InplaceFunction<void(const Timer::TimeInfo&)>;
 
 		explicit ScopedTimer(TimeInfoCallback callback = nullptr) noexcept
 			: m_callback(std::move(callback))
@@ -0,0 +1,429 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Containers/ThreadSafePriorityQueue.h>
+#include <Elos/Window/WindowCommand.h>
+#include <Elos/Window/WindowCommandBatch.h>
+#include <Elos/Window/WindowCommandCoalescer.h>
+#include <Elos/Window/WindowLoop.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Elos
+{
+	/**
+	 * @brief One thread running the commands and messages of any number of windows
+	 *
+	 * Windows Attach a Target, which provides an Execute overload for every WindowCommand payload,
+	 * and get back the id their commands are routed by. All windows share one command queue and
+	 * one WindowLoop over Source. Each pass groups the drained commands by window, coalesces them
+	 * per window and runs them, so one window's resize burst can't override another's. Windows run
+	 * in the order their first command arrived. Source may provide EnterThread and LeaveThread,
+	 * called on the host thread around the loop. A Target may provide FlushEvents, which the host
+	 * calls once the pass's messages are dispatched if the target asked for it with DeferFlush.
+	 *
+	 * Targets run without the host's lock held, so a slow call into one window doesn't hold up Attach
+	 * or Detach of another. A command that throws without a waiter is counted, handed to the command
+	 * error handler if one is set, and the window's remaining commands still run.
+	 *
+	 * Attach, Detach, Post and Submit may be called from any thread except the host's own. The host must
+	 * not be destroyed on its own thread either.
+	 */
+	template <WindowMessageSource Source, typename Target>
+	class BasicWindowHost
+	{
+	public:
+		// Called on the host thread with the window and what its command threw. Must not throw
+		using CommandErrorHandler = std::function<void(WindowId, std::exception_ptr)>;
+
+		BasicWindowHost()
+		{
+			m_thread = std::thread(&BasicWindowHost::ThreadMain, this);
+		}
+
+		~BasicWindowHost()
+		{
+			m_commands.Close();
+			m_loop.Stop();
+			if (m_thread.joinable())
+			{
+				m_thread.join();
+			}
+
+			// Whatever was still queued is dropped; release anyone waiting on it
+			m_completed->store(std::numeric_limits<u64>::max(), std::memory_order_release);
+			m_completed->notify_all();
+		}
+
+		BasicWindowHost(const BasicWindowHost&) = delete;
+		BasicWindowHost& operator=(const BasicWindowHost&) = delete;
+
+		// Routes commands for the returned id to target until Detach
+		NODISCARD WindowId Attach(Target& target)
+		{
+			std::lock_guard<std::mutex> lock(m_slotsMutex);
+			const WindowId id = m_nextId++;
+			m_slots.emplace(id, std::make_unique<Slot>(id, &target));
+			return id;
+		}
+
+		// Once this returns the host no longer touches the target, so it waits out commands the host
+		// is running for it. Commands still queued for it are dropped and their waiters released
+		void Detach(WindowId id)
+		{
+			std::unique_lock<std::mutex> lock(m_slotsMutex);
+			m_slotReleased.wait(lock, [this, id]()
+			{
+				const auto it = m_slots.find(id);
+				return it == m_slots.end() || !it->second->Pinned;
+			});
+			m_slots.erase(id);
+		}
+
+		void Post(WindowId id, WindowCommand::Payload data)
+		{
+			m_commands.Push(RoutedCommand{ id, WindowCommand{ std::move(data) } });
+			m_loop.Notify();
+		}
+
+		// Returns once the command has run, rethrowing anything it threw
+		void PostAndWait(WindowId id, WindowCommand::Payload data)
+		{
+			std::promise<void> promise;
+			std::future<void> future = promise.get_future();
+
+			m_commands.Push(RoutedCommand{ id, WindowCommand{ std::move(data), &promise } });
+			m_loop.Notify();
+			future.get();
+		}
+
+		// Queues the payloads for id as one batch, moving them out of the range. The token completes
+		// once the host has run the whole batch, or dropped it along with a detached window
+		template <std::ranges::sized_range Payloads>
+		WindowCommandToken Submit(WindowId id, Payloads&& payloads)
+		{
+			size_t remaining = std::ranges::size(payloads);
+			if (remaining == 0)
+			{
+				return {};
+			}
+
+			u64 ticket = 0;
+			{
+				// Tickets enter the queue in order, so once ticket n is drained every earlier one has been too
+				std::lock_guard<std::mutex> lock(m_submitMutex);
+				ticket = ++m_issued;
+				m_commands.PushRange(payloads | std::views::transform([&](WindowCommand::Payload& data)
+				{
+					RoutedCommand routed{ id, WindowCommand{ std::move(data) } };
+					routed.Ticket = --remaining == 0 ? ticket : 0;
+					return routed;
+				}));
+			}
+			m_loop.Notify();
+			return WindowCommandToken(m_completed, ticket);
+		}
+
+		// Host thread only, e.g. from a message handler. Calls the target's FlushEvents after this pass's messages
+		void DeferFlush(WindowId id)
+		{
+			m_flushes.push_back(id);
+		}
+
+		NODISCARD size_t GetWindowCount() const
+		{
+			std::lock_guard<std::mutex> lock(m_slotsMutex);
+			return m_slots.size();
+		}
+
+		// Commands dropped for id because a later one overrode them
+		NODISCARD u64 GetElidedCommandCount(WindowId id) const
+		{
+			std::lock_guard<std::mutex> lock(m_slotsMutex);
+			const auto it = m_slots.find(id);
+			return it != m_slots.end() ? it->second->Coalescer.GetElidedCount() : 0;
+		}
+
+		// Commands for id that threw with nobody waiting on them
+		NODISCARD u64 GetFailedCommandCount(WindowId id) const
+		{
+			std::lock_guard<std::mutex> lock(m_slotsMutex);
+			const auto it = m_slots.find(id);
+			return it != m_slots.end() ? it->second->Failed.load(std::memory_order_relaxed) : 0;
+		}
+
+		// Replaces the handler for commands that throw with nobody waiting on them
+		void SetCommandErrorHandler(CommandErrorHandler handler)
+		{
+			std::lock_guard<std::mutex> lock(m_errorMutex);
+			m_errorHandler = std::move(handler);
+		}
+
+		// Covers the commands of every window on this host
+		QueueTelemetry& EnableCommandQueueTelemetry() { return m_commands.EnableTelemetry(); }
+
+		NODISCARD std::thread::id GetThreadId() const noexcept { return m_thread.get_id(); }
+
+		// Passes through the host loop so far, i.e. how often its thread has woken
+		NODISCARD u64 GetPassCount() const noexcept { return m_loop.GetPassCount(); }
+
+	private:
+		struct RoutedCommand
+		{
+			WindowId      Id;
+			WindowCommand Command;
+			u64           Ticket = 0;  // Set on the last command of a submitted batch
+		};
+
+		// Ranks by the command alone, so redraws trail across windows too
+		struct RoutedOrder
+		{
+			bool operator()(const RoutedCommand& a, const RoutedCommand& b) const noexcept
+			{
+				return WindowCommandOrder{}(a.Command, b.Command);
+			}
+		};
+
+		struct Slot
+		{
+			Slot(WindowId id, Target* target) : Id(id), Receiver(target) {}
+
+			WindowId               Id;
+			Target*                Receiver;
+			WindowCommandCoalescer Coalescer;
+			std::atomic<u64>       Failed{ 0 };
+			bool                   Pinned = false;  // Guarded by m_slotsMutex; set while the host runs the target
+		};
+
+		// Unpins the slots in m_ready, and publishes the pass's ticket, however the pass ends
+		struct PassGuard
+		{
+			BasicWindowHost& Host;
+			u64              CompletedTicket = 0;
+
+			~PassGuard()
+			{
+				Host.UnpinReady();
+				if (CompletedTicket != 0)
+				{
+					Host.m_completed->store(CompletedTicket, std::memory_order_release);
+					Host.m_completed->notify_all();
+				}
+			}
+		};
+
+		void ThreadMain()
+		{
+			if constexpr (requires { m_source.EnterThread(); })
+			{
+				m_source.EnterThread();
+			}
+
+			m_loop.Run([this] { ProcessCommands(); }, [this] { FlushDeferred(); });
+
+			if constexpr (requires { m_source.LeaveThread(); })
+			{
+				m_source.LeaveThread();
+			}
+		}
+
+		void ProcessCommands()
+		{
+			m_commands.DrainTo(std::back_inserter(m_drained));
+			if (m_drained.empty())
+			{
+				return;
+			}
+
+			PassGuard guard{ *this };
+			{
+				// Pinned slots stay in the map until they are released, so they run without the lock
+				std::lock_guard<std::mutex> lock(m_slotsMutex);
+				for (RoutedCommand& routed : m_drained)
+				{
+					guard.CompletedTicket = std::max(guard.CompletedTicket, routed.Ticket);
+
+					const auto it = m_slots.find(routed.Id);
+					if (it == m_slots.end())
+					{
+						if (routed.Command.Completion)
+						{
+							routed.Command.Completion->set_value();
+						}
+						continue;
+					}
+
+					Slot& slot = *it->second;
+					Pin(slot);
+					slot.Coalescer.Add(std::move(routed.Command));
+				}
+			}
+			m_drained.clear();
+
+			for (Slot* slot : m_ready)
+			{
+				Run(*slot);
+			}
+		}
+
+		// Runs everything pending for slot; a command that throws is reported and the rest still run
+		void Run(Slot& slot)
+		{
+			while (!slot.Coalescer.Empty())
+			{
+				try
+				{
+					slot.Coalescer.Execute([receiver = slot.Receiver](const auto& payload) { receiver->Execute(payload); });
+				}
+				catch (...)
+				{
+					slot.Failed.fetch_add(1, std::memory_order_relaxed);
+					ReportError(slot.Id, std::current_exception());
+				}
+			}
+		}
+
+		void ReportError(WindowId id, std::exception_ptr error)
+		{
+			CommandErrorHandler handler;
+			{
+				std::lock_guard<std::mutex> lock(m_errorMutex);
+				handler = m_errorHandler;
+			}
+
+			if (handler)
+			{
+				handler(id, std::move(error));
+			}
+		}
+
+		// m_slotsMutex must be held. Adds slot to m_ready once per pass
+		void Pin(Slot& slot)
+		{
+			if (!slot.Pinned)
+			{
+				slot.Pinned = true;
+				m_ready.push_back(&slot);
+			}
+		}
+
+		void UnpinReady()
+		{
+			if (m_ready.empty())
+			{
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_slotsMutex);
+				for (Slot* slot : m_ready)
+				{
+					slot->Pinned = false;
+				}
+			}
+			m_ready.clear();
+			m_slotReleased.notify_all();
+		}
+
+		void FlushDeferred()
+		{
+			if (m_flushes.empty())
+			{
+				return;
+			}
+
+			PassGuard guard{ *this };
+			{
+				std::lock_guard<std::mutex> lock(m_slotsMutex);
+				for (const WindowId id : m_flushes)
+				{
+					const auto it = m_slots.find(id);
+					if (it != m_slots.end())
+					{
+						Pin(*it->second);
+					}
+				}
+			}
+			m_flushes.clear();
+
+			if constexpr (requires(Target& target) { target.FlushEvents(); })
+			{
+				for (Slot* slot : m_ready)
+				{
+					slot->Receiver->FlushEvents();
+				}
+			}
+		}
+
+	private:
+		using CommandQueue = ThreadSafePriorityQueue<RoutedCommand, RoutedOrder>;
+
+		Source                                              m_source;
+		WindowLoop<Source>                                  m_loop{ m_source };
+		CommandQueue                                        m_commands;
+		std::unordered_map<WindowId, std::unique_ptr<Slot>> m_slots;  // Slots keep their address while the map rehashes
+		mutable std::mutex                                  m_slotsMutex;
+		std::condition_variable                             m_slotReleased;
+		WindowId                                            m_nextId = 1;
+
+		std::mutex          m_errorMutex;
+		CommandErrorHandler m_errorHandler;
+
+		// Batch tickets: the last one Submit issued, and the highest one run, which tokens read
+		std::mutex                        m_submitMutex;
+		u64                               m_issued = 0;
+		std::shared_ptr<std::atomic<u64>> m_completed = std::make_shared<std::atomic<u64>>(0);
+
+		// Host thread only, reused every pass
+		std::vector<RoutedCommand> m_drained;
+		std::vector<Slot*>         m_ready;  // Pinned for the current pass
+		std::vector<WindowId>      m_flushes;
+
+		std::thread m_thread;  // Last, so everything above exists before it starts
+	};
+
+	/**
+	 * @brief A fixed set of hosts for spreading windows over a few threads
+	 *
+	 * Pick hands out the host with the fewest windows, so top-level windows balance across the pool;
+	 * children normally stay on their parent's host.
+	 */
+	template <typename Host>
+	class BasicWindowHostPool
+	{
+	public:
+		explicit BasicWindowHostPool(u32 threadCount)
+		{
+			m_hosts.reserve(std::max(threadCount, 1u));
+			for (u32 i = 0; i < std::max(threadCount, 1u); ++i)
+			{
+				m_hosts.push_back(std::make_shared<Host>());
+			}
+		}
+
+		NODISCARD std::shared_ptr<Host> Pick() const
+		{
+			return *std::min_element(m_hosts.begin(), m_hosts.end(), [](const auto& a, const auto& b)
+			{
+				return a->GetWindowCount() < b->GetWindowCount();
+			});
+		}
+
+		NODISCARD const std::vector<std::shared_ptr<Host>>& GetHosts() const noexcept { return m_hosts; }
+
+	private:
+		std::vector<std::shared_ptr<Host>> m_hosts;
+	};
+}
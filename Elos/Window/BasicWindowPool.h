@@ -0,0 +1,193 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Utils/LatencyHistogram.h>
+#include <Elos/Utils/Timer.h>
+#include <Elos/Window/WindowTypes.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace Elos
+{
+	struct WindowPoolStats
+	{
+		u64 Hits      = 0;  // Acquires served by a warm window
+		u64 Misses    = 0;  // Acquires that had to create one
+		u64 Recycled  = 0;  // Releases kept for reuse
+		u64 Discarded = 0;  // Releases dropped because the window was closed or the pool was full
+
+		LatencyHistogram AcquireLatency;  // Call to return of Acquire, hits and misses alike
+
+		NODISCARD f64 HitRate() const noexcept
+		{
+			const u64 acquired = Hits + Misses;
+			return acquired ? static_cast<f64>(Hits) / static_cast<f64>(acquired) : 0.0;
+		}
+	};
+
+	/**
+	 * @brief Hidden, already created windows handed out for popups, tooltips and dialogs
+	 *
+	 * Every pooled window is created from one prototype, so they share its style, child mode,
+	 * parent and host. Acquire reconfigures a warm window's title, size and position with a single
+	 * command batch and shows it; asking for a different style, child mode, parent or host falls
+	 * back to creating a window. A default position keeps wherever the window last was. Release
+	 * hides the window and keeps it for the next Acquire while the pool has room. Give the
+	 * prototype a Host so all pooled windows share one thread.
+	 *
+	 * WindowT needs a constructor from WindowCreateInfo, IsOpen, BeginCommands and DiscardEvents.
+	 * Safe to use from any thread.
+	 */
+	template <typename WindowT>
+	class BasicWindowPool
+	{
+	public:
+		BasicWindowPool(const WindowCreateInfo& prototype, u32 capacity)
+			: m_prototype(prototype)
+			, m_capacity(capacity)
+		{
+			m_prototype.Visible = false;
+			m_idle.reserve(capacity);
+			Prewarm(capacity);
+		}
+
+		BasicWindowPool(const BasicWindowPool&) = delete;
+		BasicWindowPool& operator=(const BasicWindowPool&) = delete;
+
+		// Creates hidden windows until count are idle or the pool is full
+		void Prewarm(u32 count)
+		{
+			for (u32 idle = GetIdleCount(); idle < std::min(count, m_capacity); ++idle)
+			{
+				auto window = std::make_shared<WindowT>(m_prototype);
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_idle.size() >= m_capacity)
+				{
+					return;
+				}
+				m_idle.push_back(std::move(window));
+			}
+		}
+
+		// Shows a warm window configured from info, or creates one if none fits. The window is
+		// visible once this returns
+		NODISCARD std::shared_ptr<WindowT> Acquire(const WindowCreateInfo& info)
+		{
+			const Timer::TimePoint start = Timer::Now();
+
+			const bool compatible = IsCompatible(info);
+			std::shared_ptr<WindowT> window;
+			if (compatible)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (!m_idle.empty())
+				{
+					window = std::move(m_idle.back());
+					m_idle.pop_back();
+				}
+			}
+
+			const bool hit = window != nullptr;
+			if (hit)
+			{
+				// Whatever the window reported while it sat hidden is stale. Dropped before the batch,
+				// so the events the batch itself causes reach the caller as they would for a new window
+				window->DiscardEvents();
+
+				auto batch = window->BeginCommands();
+				batch.SetTitle(info.Title).SetSize(info.Size);
+				if (info.Position.X != DefaultWindowPosition.X || info.Position.Y != DefaultWindowPosition.Y)
+				{
+					batch.SetPosition(info.Position);
+				}
+				batch.SetVisible(info.Visible).Submit().Wait();
+			}
+			else if (compatible && !info.Host)
+			{
+				// Still a pool window, so it belongs on the pool's host
+				WindowCreateInfo coldInfo(info);
+				coldInfo.Host = m_prototype.Host;
+				window = std::make_shared<WindowT>(coldInfo);
+			}
+			else
+			{
+				window = std::make_shared<WindowT>(info);
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (compatible)
+			{
+				// Windows the callers dropped instead of releasing are forgotten here
+				std::erase_if(m_members, [](const std::weak_ptr<WindowT>& member) { return member.expired(); });
+				m_members.insert(window);
+			}
+			++(hit ? m_stats.Hits : m_stats.Misses);
+			m_stats.AcquireLatency.Record(Timer::Now() - start);
+			return window;
+		}
+
+		// Hides the window and keeps it for reuse if it is still open and the pool has room. The
+		// caller must not use it afterwards
+		void Release(std::shared_ptr<WindowT> window)
+		{
+			if (!window)
+			{
+				return;
+			}
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			const auto member = m_members.find(window);
+			const bool isMember = member != m_members.end();
+			if (isMember)
+			{
+				m_members.erase(member);
+			}
+
+			if (!isMember || !window->IsOpen() || m_idle.size() >= m_capacity)
+			{
+				++m_stats.Discarded;
+				lock.unlock();
+				return;  // Destroyed outside the lock, closing the window can take a while
+			}
+			window->BeginCommands().SetVisible(false).Submit();
+			m_idle.push_back(std::move(window));
+			++m_stats.Recycled;
+		}
+
+		NODISCARD u32 GetIdleCount() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return static_cast<u32>(m_idle.size());
+		}
+
+		NODISCARD u32 GetCapacity() const noexcept { return m_capacity; }
+
+		NODISCARD WindowPoolStats GetStats() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_stats;
+		}
+
+	private:
+		// Everything Acquire can't change on an existing window has to match the prototype
+		NODISCARD bool IsCompatible(const WindowCreateInfo& info) const noexcept
+		{
+			return info.Style == m_prototype.Style
+				&& info.ChildMode == m_prototype.ChildMode
+				&& info.Parent == m_prototype.Parent
+				&& (!info.Host || info.Host == m_prototype.Host);
+		}
+
+	private:
+		WindowCreateInfo                                    m_prototype;
+		u32                                                 m_capacity;
+		mutable std::mutex                                  m_mutex;
+		std::vector<std::shared_ptr<WindowT>>               m_idle;
+		std::set<std::weak_ptr<WindowT>, std::owner_less<>> m_members;  // Handed out and built like the prototype, so Release may keep them
+		WindowPoolStats                                     m_stats;
+	};
+}
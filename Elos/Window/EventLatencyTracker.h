@@ -0,0 +1,63 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Utils/LatencyHistogram.h>
+#include <Elos/Utils/Timer.h>
+#include <Elos/Window/WindowEvents.h>
+#include <array>
+#include <mutex>
+#include <span>
+
+namespace Elos
+{
+	// Receipt-to-dispatch latency, over every event and per event type
+	struct EventLatencyStats
+	{
+		LatencyHistogram                                All;
+		std::array<LatencyHistogram, Event::TypeCount> ByType{};
+
+		template <typename T>
+		NODISCARD const LatencyHistogram& For() const noexcept { return ByType[Event::TypeIndexOf<T>()]; }
+	};
+
+	/**
+	 * @brief Records how long events wait between their receipt and being handed to handlers
+	 *
+	 * Covers the OS message queue where the event's timestamp comes from the OS, the host thread,
+	 * and the window's event queue up to the frame that dispatches it. Events without a timestamp
+	 * are skipped. Record takes one lock per batch; stats can be read from any thread.
+	 */
+	class EventLatencyTracker
+	{
+	public:
+		void Record(std::span<const Event> events, Timer::TimePoint dispatchedAt)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (const Event& event : events)
+			{
+				if (event.HasTimestamp())
+				{
+					const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(dispatchedAt - event.GetTimestamp());
+					m_stats.All.Record(latency);
+					m_stats.ByType[event.GetTypeIndex()].Record(latency);
+				}
+			}
+		}
+
+		NODISCARD EventLatencyStats GetStats() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_stats;
+		}
+
+		void Reset()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stats = {};
+		}
+
+	private:
+		mutable std::mutex m_mutex;
+		EventLatencyStats  m_stats;
+	};
+}
@@ -4,7 +4,7 @@
 namespace Elos::UI
 {
 	
-	Button::Builder& Button::Builder::OnClick(std::function<void(Button&)> callback)
+	Button::Builder& Button::Builder::OnClick(ClickCallback callback)
 	{
 		m_onClick = std::move(callback);
 		return *this;
@@ -111,7 +111,7 @@ namespace Elos::UI
 		return m_buttonWindow->GetSize();
 	}
 		
-	void Button::SetOnClick(std::function<void(Button&)> callback)
+	void Button::SetOnClick(ClickCallback callback)
 	{
 		m_onClick = std::move(callback);
 	}
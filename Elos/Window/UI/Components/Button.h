@@ -1,18 +1,20 @@
 #pragma once
 #include <Elos/Window/UI/Components/UIElement.h>
-#include <functional>
+#include <Elos/Common/InplaceFunction.h>
 
 namespace Elos::UI
 {
 	class Button : public UIElement
 	{
 	public:
+		using ClickCallback = InplaceFunction<void(Button&)>;
+
 		class Builder
 		{
 		public:
 			Builder() = default;
 
-			Builder& OnClick(std::function<void(Button&)> callback);
+			Builder& OnClick(ClickCallback callback);
 			Builder& IsEnabled(bool enabled);
 			Builder& SetBorder(bool hasBorder);
 			Builder& SetColor(COLORREF color);
@@ -25,16 +27,16 @@ namespace Elos::UI
 			std::shared_ptr<Button> Build(std::shared_ptr<Window> parent);
 
 		private:
-			std::function<void(Button&)> m_onClick;
-			bool                         m_isEnabled    = true;
-			bool                         m_hasBorder    = false;
-			COLORREF                     m_color        = RGB(200, 200, 200);
-			COLORREF                     m_colorHovered = RGB(220, 220, 220);
-			COLORREF                     m_colorPressed = RGB(180, 180, 180);
-			COLORREF                     m_textColor    = RGB(0, 0, 0);
-			WindowPosition               m_position     = { 0, 0 };
-			WindowSize                   m_size         = { 100, 30 };
-			String                       m_text         = "Button";
+			ClickCallback  m_onClick;
+			bool           m_isEnabled    = true;
+			bool           m_hasBorder    = false;
+			COLORREF       m_color        = RGB(200, 200, 200);
+			COLORREF       m_colorHovered = RGB(220, 220, 220);
+			COLORREF       m_colorPressed = RGB(180, 180, 180);
+			COLORREF       m_textColor    = RGB(0, 0, 0);
+			WindowPosition m_position     = { 0, 0 };
+			WindowSize     m_size         = { 100, 30 };
+			String         m_text         = "Button";
 
 			friend class Button;
 		};
@@ -50,7 +52,7 @@ namespace Elos::UI
 		WindowPosition GetPosition() const;
 		void SetSize(const WindowSize& size);
 		WindowSize GetSize();
-		void SetOnClick(std::function<void(Button&)> callback);
+		void SetOnClick(ClickCallback callback);
 		void SetColor(COLORREF color);
 		void SetColorHovered(COLORREF color);
 		void SetColorPressed(COLORREF color);
@@ -84,6 +86,6 @@ namespace Elos::UI
 		};
 		ButtonState m_state = ButtonState::Normal;
 
-		std::function<void(Button&)> m_onClick;
+		ClickCallback m_onClick;
 	};
 }
\ No newline at end of file
@@ -7,6 +7,14 @@ namespace Elos
     u32 Window::s_windowCount = 0;
     const wchar_t* Window::s_className = L"ElosWindowClass";
 
+    WindowHost::WindowHost() = default;
+    WindowHost::~WindowHost() = default;
+
+    std::shared_ptr<WindowHost> WindowHost::Create()
+    {
+        return std::make_shared<WindowHost>();
+    }
+
     Window::Window(const WindowCreateInfo& createInfo)
     {
         m_keyboard = std::make_unique<Keyboard>(*this);
@@ -16,10 +24,17 @@ namespace Elos
         m_childMode = createInfo.ChildMode;
         m_parent    = createInfo.Parent;
 
-        m_windowThread = std::make_unique<WindowThread>(this);
+        // Children share their parent's thread unless told otherwise, so a panel of buttons runs on one thread
+        std::shared_ptr<WindowHost> host = createInfo.Host;
+        if (auto parent = m_parent.lock(); !host && parent)
+            host = parent->GetHost();
+        if (!host)
+            host = WindowHost::Create();
+
+        m_windowThread = std::make_unique<WindowThread>(this, std::move(host));
 
-        // Create the window on its own thread
-        QueueCommandAndWait(CommandType::Create, createInfo);
+        // Create the window on its host thread
+        QueueCommandAndWait(WindowCommand::Create{ createInfo });
     }
 
     Window::~Window()
@@ -48,27 +63,24 @@ namespace Elos
         return child;
     }
 
+    std::shared_ptr<WindowHost> Window::GetHost() const
+    {
+        return m_windowThread ? m_windowThread->GetHost() : nullptr;
+    }
+
     bool Window::IsOpen() const
     {
-        return m_handle != nullptr;
+        return m_state.Load().Open;
     }
 
     WindowPosition Window::GetPosition() const
     {
-        std::lock_guard<std::recursive_mutex> lock(m_windowMutex);
-
-        if (!m_handle)
-            return { 0, 0 };
-
-        RECT rect;
-        ::GetWindowRect(m_handle, &rect);
-        return { static_cast<i32>(rect.left), static_cast<i32>(rect.top) };
+        return m_state.Load().Position;
     }
 
     WindowSize Window::GetSize() const
     {
-        std::lock_guard<std::recursive_mutex> lock(m_windowMutex);
-        return m_size;
+        return m_state.Load().Size;
     }
 
     WindowHandle Window::GetHandle() const
@@ -78,17 +90,17 @@ namespace Elos
 
     void Window::Close()
     {
-        QueueCommandAndWait(CommandType::Close);
+        QueueCommandAndWait(WindowCommand::Close{});
     }
 
     void Window::SetPosition(const WindowPosition& position)
     {
-        QueueCommand(CommandType::SetPosition, position);
+        QueueCommand(WindowCommand::SetPosition{ position });
     }
 
     void Window::SetSize(const WindowSize& size)
     {
-        QueueCommand(CommandType::SetSize, size);
+        QueueCommand(WindowCommand::SetSize{ size });
     }
 
     void Window::SetMinimumSize(const WindowSize& size)
@@ -102,25 +114,30 @@ namespace Elos
 
     void Window::SetTitle(const String& title)
     {
-        QueueCommand(CommandType::SetTitle, title);
+        QueueCommand(WindowCommand::SetTitle{ WindowTitle(title) });
     }
 
     void Window::SetVisible(bool visible)
     {
-        QueueCommand(CommandType::SetVisible, visible);
+        QueueCommand(WindowCommand::SetVisible{ visible });
     }
 
     void Window::RequestFocus()
     {
-        QueueCommand(CommandType::RequestFocus);
+        QueueCommand(WindowCommand::RequestFocus{});
     }
 
-    bool Window::HasFocus() const
+    WindowCommandBatch Window::BeginCommands()
     {
-        if (!m_handle)
-            return false;
+        if (!m_windowThread)
+            return WindowCommandBatch(nullptr, 0);
 
-        return m_handle == ::GetForegroundWindow();
+        return WindowCommandBatch(m_windowThread->GetHost().get(), m_windowThread->GetId());
+    }
+
+    bool Window::HasFocus() const
+    {
+        return m_state.Load().Focused;
     }
 
     void Window::SetBackgroundColor(COLORREF color)
@@ -134,7 +151,7 @@ namespace Elos
 
     void Window::Redraw()
     {
-        QueueCommand(CommandType::Redraw);
+        QueueCommand(WindowCommand::Redraw{});
     }
 
     std::optional<Event> Window::PollEvent()
@@ -142,21 +159,57 @@ namespace Elos
         return m_events.TryPop();
     }
 
-    void Window::PushEvent(const Event& event)
+    u64 Window::PollEvents(std::span<Event> events)
     {
+        return m_events.PopBatch(events);
+    }
+
+    u64 Window::PollEvents(std::vector<Event>& events)
+    {
+        return m_events.SwapOut(events);
+    }
+
+    void Window::PushEvent(Event event)
+    {
+        if (event.IsEmpty())
+            return;
+
+        if (!event.HasTimestamp())
+            event.SetTimestamp(Timer::Now());
         m_events.Push(event);
     }
 
-    void Window::QueueCommand(CommandType type, std::any data)
+    EventLatencyTracker& Window::EnableEventLatencyTracking()
+    {
+        std::lock_guard<std::recursive_mutex> lock(m_windowMutex);
+        if (!m_eventLatencyStorage)
+        {
+            m_eventLatencyStorage = std::make_unique<EventLatencyTracker>();
+            m_eventLatency.store(m_eventLatencyStorage.get(), std::memory_order_release);
+        }
+        return *m_eventLatencyStorage;
+    }
+
+    QueueTelemetry* Window::EnableCommandQueueTelemetry()
+    {
+        return m_windowThread ? &m_windowThread->EnableCommandQueueTelemetry() : nullptr;
+    }
+
+    u64 Window::GetElidedCommandCount() const
+    {
+        return m_windowThread ? m_windowThread->GetElidedCommandCount() : 0;
+    }
+
+    void Window::QueueCommand(WindowCommand::Payload data)
     {
         if (m_windowThread)
-            m_windowThread->QueueCommand(type, data);
+            m_windowThread->QueueCommand(std::move(data));
     }
 
-    void Window::QueueCommandAndWait(CommandType type, std::any data)
+    void Window::QueueCommandAndWait(WindowCommand::Payload data)
     {
         if (m_windowThread)
-            m_windowThread->QueueCommandAndWait(type, data);
+            m_windowThread->QueueCommandAndWait(std::move(data));
     }
     
     void Window::SetDPIAwareness() const
@@ -2,16 +2,23 @@
 
 #include <Elos/Export.h>
 #include <Elos/Common/String.h>
-#include <Elos/Containers/ThreadSafeQueue.h>
+#include <Elos/Containers/SeqLock.h>
+#include <Elos/Window/EventLatencyTracker.h>
 #include <Elos/Window/Input/Keyboard.h>
 #include <Elos/Window/Input/Mouse.h>
+#include <Elos/Window/WindowCommand.h>
 #include <Elos/Window/WindowEvents.h>
+#include <Elos/Window/WindowEventQueue.h>
+#include <Elos/Window/WindowHost.h>
 #include <Elos/Window/WindowHandle.h>
 #include <Elos/Window/WindowTypes.h>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <span>
+#include <type_traits>
 #include <vector>
-#include <any>
 #include <Windows.h>
 #include <future>
 
@@ -19,6 +26,11 @@ namespace Elos
 {
     class WindowThread;
 
+    namespace Internal
+    {
+        class WindowEventHandlerDispatcher;
+    }
+
     class ELOS_API Window : public std::enable_shared_from_this<Window>
     {
     public:
@@ -33,10 +45,18 @@ namespace Elos
 
         NODISCARD std::shared_ptr<Window> CreateChild(const WindowCreateInfo& createInfo);
 
+        // State getters read the snapshot the window thread last published: no lock and no syscall,
+        // safe from any thread, and a single GetState is consistent across all fields
+        NODISCARD WindowState GetState() const { return m_state.Load(); }
+        NODISCARD u64 GetStateVersion() const { return m_state.GetVersion(); }
         NODISCARD bool IsOpen() const;
         NODISCARD WindowPosition GetPosition() const;
         NODISCARD WindowSize GetSize() const;
+        NODISCARD bool IsVisible() const { return m_state.Load().Visible; }
+        NODISCARD bool IsMinimized() const { return m_state.Load().Minimized; }
+        NODISCARD u32 GetDpi() const { return m_state.Load().Dpi; }
         NODISCARD WindowHandle GetHandle() const;
+        NODISCARD std::shared_ptr<WindowHost> GetHost() const;
 
         void Close();
         void SetPosition(const WindowPosition& position);
@@ -45,12 +65,50 @@ namespace Elos
         void SetTitle(const String& title);
         void SetVisible(bool visible);
         void RequestFocus();
-        bool HasFocus() const;
+        NODISCARD bool HasFocus() const;
         void SetBackgroundColor(COLORREF color);
         void Redraw();
 
+        // Collects commands to queue together with one completion token, e.g.
+        // BeginCommands().SetSize(size).SetTitle(title).Submit().Wait(). Submit before the window is destroyed
+        NODISCARD WindowCommandBatch BeginCommands();
+
+        // Events are polled by one thread at a time, usually the one that owns the window
         NODISCARD std::optional<Event> PollEvent();
 
+        // Copies up to events.size() pending events into events, returns how many
+        u64 PollEvents(std::span<Event> events);
+
+        // Replaces the contents of events with every pending event
+        u64 PollEvents(std::vector<Event>& events);
+
+        // Drops every pending event, e.g. those a pooled window collected while hidden
+        void DiscardEvents() { m_events.Clear(); }
+
+        // Merges runs of mouse moves, raw mouse deltas, wheel scrolls and resizes into one event each
+        // before they are queued. Order relative to every other event is kept. Off by default
+        void SetEventCoalescing(bool enabled) { m_events.SetCoalescing(enabled); }
+        NODISCARD bool IsEventCoalescing() const { return m_events.IsCoalescing(); }
+
+        // Events dropped because the queue was full, merged by coalescing, and the most taken by one poll
+        NODISCARD QueueCounters GetEventQueueCounters() const { return m_events.GetCounters(); }
+        NODISCARD EventMergeCounters GetEventMergeCounters() const { return m_events.GetMergeCounters(); }
+
+        // Depth, rates and latency of the pending event and command queues, for monitoring. Stays on once
+        // enabled. Event queue latency runs from each event's receipt to the poll that takes it. The command
+        // queue is shared by every window on the same host, its telemetry is null for a window without a host
+        QueueTelemetry& EnableEventQueueTelemetry() { return m_events.EnableTelemetry(); }
+        QueueTelemetry* EnableCommandQueueTelemetry();
+
+        // Histograms of how long events wait between receipt and HandleEvents passing them to handlers.
+        // Stays on once enabled; null until then
+        EventLatencyTracker& EnableEventLatencyTracking();
+        NODISCARD EventLatencyTracker* GetEventLatencyTracker() const { return m_eventLatency.load(std::memory_order_acquire); }
+
+        // SetPosition, SetSize, SetTitle, SetVisible and Redraw calls dropped because a later call overrode them
+        // before the window thread got to them
+        NODISCARD u64 GetElidedCommandCount() const;
+
         template <typename... Handlers>
         void HandleEvents(Handlers&&... handlers);
 
@@ -61,42 +119,22 @@ namespace Elos
 
     private:
         friend class WindowThread;
+        friend class Internal::WindowEventHandlerDispatcher;
 
-        enum class CommandType
-        {
-            Create,
-            Close,
-            SetPosition,
-            SetSize,
-            SetTitle,
-            SetVisible,
-            RequestFocus,
-            Redraw,
-            AddChild,
-            RemoveChild
-        };
-
-        struct Command
-        {
-            CommandType type;
-            std::any data;
-            std::promise<void>* completion = nullptr;
-        };
-
-        void QueueCommand(CommandType type, std::any data = {});
-        void QueueCommandAndWait(CommandType type, std::any data = {});
+        void QueueCommand(WindowCommand::Payload data);
+        void QueueCommandAndWait(WindowCommand::Payload data);
         void SetDPIAwareness() const;
-        void PushEvent(const Event& event);
+        void PushEvent(Event event);
 
     private:
-        WindowSize                           m_size{ 0, 0 };
+        SeqLock<WindowState>                 m_state;  // Written by the window thread only
         WindowSize                           m_minimumSize{ 20, 20 };
         char16                               m_surrogate{ 0 };
         WindowChildMode                      m_childMode{ WindowChildMode::None };
         std::unique_ptr<Keyboard>            m_keyboard;
         std::unique_ptr<Mouse>               m_mouse;
         std::weak_ptr<Window>                m_parent;
-        ThreadSafeQueue<Event>               m_events;
+        WindowEventQueue                     m_events;  // Pushed by the host thread only
         std::vector<std::shared_ptr<Window>> m_children;
         mutable String                       m_title;
         COLORREF                             m_backgroundColor = RGB(19, 22, 27);
@@ -111,7 +149,9 @@ namespace Elos
         // Thread-specific data
         std::unique_ptr<WindowThread>        m_windowThread;
         mutable std::recursive_mutex         m_windowMutex;
-        WindowHandle                         m_handle{ nullptr };  // Accessed from both threads
+        std::atomic<WindowHandle>            m_handle{ nullptr };  // Accessed from both threads
+        std::unique_ptr<EventLatencyTracker> m_eventLatencyStorage;
+        std::atomic<EventLatencyTracker*>    m_eventLatency{ nullptr };  // Set once by EnableEventLatencyTracking
 
         static u32            s_windowCount;
         static const wchar_t* s_className;
@@ -150,9 +190,26 @@ namespace Elos
         {
             auto combined = OverloadSet<Handlers...>{ std::forward<Handlers>(handlers)... };
 
-            while (auto event = window.PollEvent())
+            // Drains in chunks on the stack, so a handler that re-enters HandleEvents gets its own. Stops at a
+            // short chunk rather than chasing events the handlers themselves cause
+            std::array<Event, 64> events;
+            u64 count = events.size();
+            while (count == events.size())
             {
-                event->visit(combined);
+                count = window.PollEvents(events);
+                if (EventLatencyTracker* tracker = window.GetEventLatencyTracker())
+                {
+                    tracker->Record(std::span<const Event>(events.data(), count), Timer::Now());
+                }
+
+                for (u64 i = 0; i < count; ++i)
+                {
+                    events[i].visit([&combined](const auto& data)
+                    {
+                        if constexpr (!std::is_same_v<std::decay_t<decltype(data)>, Event::None>)
+                            combined(data);
+                    });
+                }
             }
         }
     }
@@ -0,0 +1,96 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/InlineString.h>
+#include <Elos/Window/WindowTypes.h>
+#include <exception>
+#include <future>
+#include <type_traits>
+#include <variant>
+
+namespace Elos
+{
+	// Titles up to this many bytes are queued without allocating
+	using WindowTitle = InlineString<64>;
+
+	// Matches the order of WindowCommand::Payload
+	enum class WindowCommandType : u8
+	{
+		Create,
+		Close,
+		SetPosition,
+		SetSize,
+		SetTitle,
+		SetVisible,
+		RequestFocus,
+		Redraw
+	};
+
+	/**
+	 * @brief A request from the owning thread to the window's thread
+	 *
+	 * The payload is a variant, so queuing a command allocates nothing beyond what Create's info and
+	 * an over-long title carry. Commands are move-only; Completion, when set, is fulfilled by
+	 * ExecuteWindowCommand once the command has run.
+	 */
+	struct WindowCommand
+	{
+		struct Create       { WindowCreateInfo Info; };
+		struct Close        {};
+		struct SetPosition  { WindowPosition Position; };
+		struct SetSize      { WindowSize Size; };
+		struct SetTitle     { WindowTitle Title; };
+		struct SetVisible   { bool Visible; };
+		struct RequestFocus {};
+		struct Redraw       {};
+
+		using Payload = std::variant<Create, Close, SetPosition, SetSize, SetTitle, SetVisible, RequestFocus, Redraw>;
+
+		Payload             Data;
+		std::promise<void>* Completion = nullptr;
+
+		NODISCARD WindowCommandType GetType() const noexcept { return static_cast<WindowCommandType>(Data.index()); }
+	};
+
+	static_assert(!std::is_copy_constructible_v<WindowCommand> && std::is_nothrow_move_constructible_v<WindowCommand>);
+
+	// Queued redraws trail every other command, so Close and focus changes overtake them. Everything
+	// else keeps its order, e.g. SetVisible then RequestFocus shows before it focuses
+	struct WindowCommandOrder
+	{
+		NODISCARD static constexpr u32 GetPriority(WindowCommandType type) noexcept
+		{
+			return type == WindowCommandType::Redraw ? 0 : 1;
+		}
+
+		bool operator()(const WindowCommand& a, const WindowCommand& b) const noexcept
+		{
+			return GetPriority(a.GetType()) < GetPriority(b.GetType());
+		}
+	};
+
+	// Hands the payload to the executor overload for its type, then releases whoever waits on the
+	// command. An exception from the executor goes to the waiter, or propagates if there is none
+	template <typename Executor>
+	void ExecuteWindowCommand(WindowCommand& command, Executor&& executor)
+	{
+		try
+		{
+			std::visit(executor, command.Data);
+		}
+		catch (...)
+		{
+			if (!command.Completion)
+			{
+				throw;
+			}
+			command.Completion->set_exception(std::current_exception());
+			return;
+		}
+
+		if (command.Completion)
+		{
+			command.Completion->set_value();
+		}
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Window/WindowCommand.h>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Elos
+{
+	/**
+	 * @brief Completion of a submitted command batch, to wait on, poll or ignore
+	 *
+	 * The host numbers batches in submission order and publishes the highest one it has run, so a
+	 * token is just that counter and its own number: no promise, future or allocation per batch. A
+	 * default token, and any token once its host has stopped, counts as done.
+	 */
+	class WindowCommandToken
+	{
+	public:
+		WindowCommandToken() = default;
+		WindowCommandToken(std::shared_ptr<const std::atomic<u64>> completed, u64 sequence) noexcept
+			: m_completed(std::move(completed))
+			, m_sequence(sequence)
+		{}
+
+		NODISCARD bool IsDone() const noexcept
+		{
+			return !m_completed || m_completed->load(std::memory_order_acquire) >= m_sequence;
+		}
+
+		// Blocks until the host has run every command of the batch
+		void Wait() const noexcept
+		{
+			if (!m_completed)
+			{
+				return;
+			}
+
+			for (u64 seen = m_completed->load(std::memory_order_acquire); seen < m_sequence; seen = m_completed->load(std::memory_order_acquire))
+			{
+				m_completed->wait(seen, std::memory_order_acquire);
+			}
+		}
+
+		// Position of the batch among those submitted to its host, 0 for a default token
+		NODISCARD u64 GetSequence() const noexcept { return m_sequence; }
+
+	private:
+		std::shared_ptr<const std::atomic<u64>> m_completed;
+		u64                                     m_sequence = 0;
+	};
+
+	/**
+	 * @brief Collects commands for one window and queues them together
+	 *
+	 * Submit pushes the whole batch under one queue lock and wakes the host once, so the window
+	 * thread sees all of it in the same pass. Commands still coalesce and reorder as single posts do.
+	 * Host is BasicWindowHost or anything with the same Submit.
+	 */
+	template <typename Host>
+	class BasicWindowCommandBatch
+	{
+	public:
+		// A null host makes every Submit return a done token
+		BasicWindowCommandBatch(Host* host, WindowId id) noexcept
+			: m_host(host)
+			, m_id(id)
+		{}
+
+		BasicWindowCommandBatch& SetPosition(const WindowPosition& position)
+		{
+			return Add(WindowCommand::SetPosition{ position });
+		}
+
+		BasicWindowCommandBatch& SetSize(const WindowSize& size)
+		{
+			return Add(WindowCommand::SetSize{ size });
+		}
+
+		BasicWindowCommandBatch& SetTitle(StringView title)
+		{
+			return Add(WindowCommand::SetTitle{ WindowTitle(title) });
+		}
+
+		BasicWindowCommandBatch& SetVisible(bool visible)
+		{
+			return Add(WindowCommand::SetVisible{ visible });
+		}
+
+		BasicWindowCommandBatch& RequestFocus()
+		{
+			return Add(WindowCommand::RequestFocus{});
+		}
+
+		BasicWindowCommandBatch& Redraw()
+		{
+			return Add(WindowCommand::Redraw{});
+		}
+
+		BasicWindowCommandBatch& Add(WindowCommand::Payload data)
+		{
+			m_commands.push_back(std::move(data));
+			return *this;
+		}
+
+		NODISCARD size_t GetSize() const noexcept { return m_commands.size(); }
+
+		// Queues everything added so far and leaves the batch empty for reuse
+		WindowCommandToken Submit()
+		{
+			WindowCommandToken token;
+			if (m_host && !m_commands.empty())
+			{
+				token = m_host->Submit(m_id, std::move(m_commands));
+			}
+			m_commands.clear();
+			return token;
+		}
+
+	private:
+		Host*                               m_host;
+		WindowId                            m_id;
+		std::vector<WindowCommand::Payload> m_commands;
+	};
+}
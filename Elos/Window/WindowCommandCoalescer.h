@@ -0,0 +1,123 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Window/WindowCommand.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <variant>
+#include <vector>
+
+namespace Elos
+{
+	/**
+	 * @brief Runs the commands pending on a window thread with superseded ones removed
+	 *
+	 * Between barriers (Create and Close) only the last SetPosition, SetSize, SetTitle, SetVisible
+	 * and Redraw survive, in the place of the last one, so each piece of state is applied once
+	 * and a redraw still follows everything queued before it. Commands with a waiter are never
+	 * dropped. The elided count may be read from any thread.
+	 */
+	class WindowCommandCoalescer
+	{
+	public:
+		void Add(WindowCommand&& command) { m_pending.push_back(std::move(command)); }
+
+		// Takes everything queued in source, which provides DrainTo like ThreadSafePriorityQueue
+		template <typename Source>
+		size_t AddFrom(Source& source)
+		{
+			return source.DrainTo(std::back_inserter(m_pending));
+		}
+
+		// Drops superseded commands from the pending ones, returns how many
+		u64 Coalesce()
+		{
+			std::array<bool, s_typeCount> seen{};
+			auto write = m_pending.end();
+			for (auto read = m_pending.end(); read != m_pending.begin();)
+			{
+				--read;
+				const WindowCommandType type = read->GetType();
+				const auto slot = static_cast<size_t>(type);
+
+				if (IsBarrier(type))
+				{
+					seen.fill(false);
+				}
+				else if (IsCoalescable(type) && !read->Completion)
+				{
+					if (seen[slot])
+					{
+						continue;
+					}
+					seen[slot] = true;
+				}
+
+				--write;
+				if (write != read)
+				{
+					*write = std::move(*read);
+				}
+			}
+
+			const auto elided = static_cast<u64>(write - m_pending.begin());
+			m_pending.erase(m_pending.begin(), write);
+			m_elided.fetch_add(elided, std::memory_order_relaxed);
+			return elided;
+		}
+
+		// Coalesces, then runs the survivors in order. If a command throws, the ones after it stay pending
+		template <typename Executor>
+		void Execute(Executor&& executor)
+		{
+			Coalesce();
+			for (size_t i = 0; i < m_pending.size(); ++i)
+			{
+				try
+				{
+					ExecuteWindowCommand(m_pending[i], executor);
+				}
+				catch (...)
+				{
+					m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(i + 1));
+					throw;
+				}
+			}
+			m_pending.clear();
+		}
+
+		NODISCARD bool Empty() const noexcept { return m_pending.empty(); }
+		NODISCARD size_t GetPendingCount() const noexcept { return m_pending.size(); }
+
+		// Total commands dropped as superseded
+		NODISCARD u64 GetElidedCount() const noexcept { return m_elided.load(std::memory_order_relaxed); }
+
+		NODISCARD static constexpr bool IsBarrier(WindowCommandType type) noexcept
+		{
+			return type == WindowCommandType::Create || type == WindowCommandType::Close;
+		}
+
+		NODISCARD static constexpr bool IsCoalescable(WindowCommandType type) noexcept
+		{
+			switch (type)
+			{
+			case WindowCommandType::SetPosition:
+			case WindowCommandType::SetSize:
+			case WindowCommandType::SetTitle:
+			case WindowCommandType::SetVisible:
+			case WindowCommandType::Redraw:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+	private:
+		static constexpr size_t s_typeCount = std::variant_size_v<WindowCommand::Payload>;
+
+		std::vector<WindowCommand> m_pending;  // Keeps its capacity between passes
+		std::atomic<u64>           m_elided{ 0 };
+	};
+}
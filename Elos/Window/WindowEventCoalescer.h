@@ -0,0 +1,163 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Window/WindowEvents.h>
+#include <array>
+#include <atomic>
+
+namespace Elos
+{
+	// Events folded into an earlier one of the same kind instead of being queued
+	struct EventMergeCounters
+	{
+		u64 MouseMoved    = 0;
+		u64 MouseMovedRaw = 0;
+		u64 MouseWheel    = 0;
+		u64 Resized       = 0;
+
+		NODISCARD u64 Total() const noexcept { return MouseMoved + MouseMovedRaw + MouseWheel + Resized; }
+	};
+
+	/**
+	 * @brief Folds high-frequency input together before it is queued
+	 *
+	 * Mouse moves, raw mouse deltas, wheel scrolls and resizes are held back in a small run instead
+	 * of being published. A later event of the same kind merges into the held one: a move or resize
+	 * replaces it, raw deltas add up and wheel deltas add up per axis. Any other event, such as a
+	 * button or key, first publishes the run in arrival order and then itself, so input never moves
+	 * across a click or key press; only the high-frequency kinds may settle relative to each other
+	 * within a run. The owner also flushes the run whenever the consumer should see it, e.g. once a
+	 * batch of messages has been dispatched. A merged event keeps the timestamp of the oldest input
+	 * in it, so latency is measured from the first move rather than the last.
+	 *
+	 * Producer thread only, apart from GetCounters.
+	 */
+	class WindowEventCoalescer
+	{
+	public:
+		// Publishes event, or holds it to merge with what follows. Publish takes a const Event&
+		template <typename Publish>
+		void Add(const Event& event, Publish&& publish)
+		{
+			if (!IsMergeable(event))
+			{
+				Flush(publish);
+				publish(event);
+				return;
+			}
+
+			for (u32 i = 0; i < m_heldCount; ++i)
+			{
+				if (TryMerge(m_held[i], event))
+				{
+					return;
+				}
+			}
+			m_held[m_heldCount++] = event;
+		}
+
+		// Publishes everything held, oldest first
+		template <typename Publish>
+		void Flush(Publish&& publish)
+		{
+			for (u32 i = 0; i < m_heldCount; ++i)
+			{
+				publish(m_held[i]);
+			}
+			m_heldCount = 0;
+		}
+
+		NODISCARD bool Empty() const noexcept { return m_heldCount == 0; }
+		NODISCARD u32 GetHeldCount() const noexcept { return m_heldCount; }
+
+		// Any thread
+		NODISCARD EventMergeCounters GetCounters() const noexcept
+		{
+			return
+			{
+				.MouseMoved    = m_mouseMoved.load(std::memory_order_relaxed),
+				.MouseMovedRaw = m_mouseMovedRaw.load(std::memory_order_relaxed),
+				.MouseWheel    = m_mouseWheel.load(std::memory_order_relaxed),
+				.Resized       = m_resized.load(std::memory_order_relaxed)
+			};
+		}
+
+		NODISCARD static bool IsMergeable(const Event& event) noexcept
+		{
+			return event.Is<Event::MouseMoved>() || event.Is<Event::MouseMovedRaw>()
+				|| event.Is<Event::MouseWheelScrolled>() || event.Is<Event::Resized>();
+		}
+
+	private:
+		// Merges incoming into held if they are the same kind, and the same axis for wheels
+		bool TryMerge(Event& held, const Event& incoming) noexcept
+		{
+			if (incoming.Is<Event::MouseMoved>() && held.Is<Event::MouseMoved>())
+			{
+				Replace(held, incoming);
+				Count(m_mouseMoved);
+				return true;
+			}
+
+			if (const auto* raw = incoming.Get<Event::MouseMovedRaw>())
+			{
+				if (auto* heldRaw = held.Get<Event::MouseMovedRaw>())
+				{
+					heldRaw->DeltaX += raw->DeltaX;
+					heldRaw->DeltaY += raw->DeltaY;
+					Count(m_mouseMovedRaw);
+					return true;
+				}
+				return false;
+			}
+
+			if (const auto* wheel = incoming.Get<Event::MouseWheelScrolled>())
+			{
+				auto* heldWheel = held.Get<Event::MouseWheelScrolled>();
+				if (heldWheel && heldWheel->Wheel == wheel->Wheel)
+				{
+					heldWheel->Delta += wheel->Delta;
+					heldWheel->X      = wheel->X;
+					heldWheel->Y      = wheel->Y;
+					Count(m_mouseWheel);
+					return true;
+				}
+				return false;
+			}
+
+			if (incoming.Is<Event::Resized>() && held.Is<Event::Resized>())
+			{
+				Replace(held, incoming);
+				Count(m_resized);
+				return true;
+			}
+
+			return false;
+		}
+
+		static void Replace(Event& held, const Event& incoming) noexcept
+		{
+			const Timer::TimePoint received = held.GetTimestamp();
+			held = incoming;
+			held.SetTimestamp(received);
+		}
+
+		// Only the producer writes, so a plain load and store is enough
+		static void Count(std::atomic<u64>& counter) noexcept
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+	private:
+		// At most one held event per kind, and per axis for the wheel
+		static constexpr u32 s_maxHeld = 5;
+
+		std::array<Event, s_maxHeld> m_held;
+		u32                          m_heldCount = 0;
+
+		std::atomic<u64> m_mouseMoved{ 0 };
+		std::atomic<u64> m_mouseMovedRaw{ 0 };
+		std::atomic<u64> m_mouseWheel{ 0 };
+		std::atomic<u64> m_resized{ 0 };
+	};
+}
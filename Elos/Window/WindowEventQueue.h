@@ -0,0 +1,255 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Containers/QueueTelemetry.h>
+#include <Elos/Containers/SpscRingBuffer.h>
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <Elos/Window/WindowEventCoalescer.h>
+#include <Elos/Window/WindowEvents.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Elos
+{
+	static_assert(std::is_trivially_copyable_v<Event>, "Events are copied through a ring buffer");
+
+	/**
+	 * @brief A window's pending events, from its host thread to the thread that polls the window
+	 *
+	 * A fixed ring of Events with exactly one producer, the host thread, and one consumer at a
+	 * time. Pushing takes no lock and wakes nobody; nothing ever waits on the queue, consumers poll
+	 * it. A bulk poll copies a run of events out and publishes the space with a single store.
+	 *
+	 * Nothing is ever dropped. When the ring is full the producer spills into a locked overflow list
+	 * and keeps spilling until the consumer has drained it; the consumer only takes from the overflow
+	 * once the ring has run dry, so events still come out in the order they were pushed.
+	 *
+	 * With coalescing on, high-frequency input goes through a WindowEventCoalescer first and the
+	 * producer must Flush whenever the consumer should see what it holds.
+	 */
+	class WindowEventQueue
+	{
+	public:
+		static constexpr u64 Capacity = 1024;
+
+		WindowEventQueue() = default;
+
+		WindowEventQueue(const WindowEventQueue&) = delete;
+		WindowEventQueue& operator=(const WindowEventQueue&) = delete;
+
+		// Producer side
+
+		void Push(const Event& event)
+		{
+			if (m_coalescing.load(std::memory_order_relaxed))
+			{
+				m_coalescer.Add(event, [this](const Event& ready) { Publish(ready); });
+				return;
+			}
+
+			// Coalescing was just switched off
+			if (!m_coalescer.Empty())
+			{
+				Flush();
+			}
+			Publish(event);
+		}
+
+		// Publishes the events the coalescer holds
+		void Flush()
+		{
+			m_coalescer.Flush([this](const Event& ready) { Publish(ready); });
+		}
+
+		NODISCARD bool HasHeldEvents() const noexcept { return !m_coalescer.Empty(); }
+
+		// Consumer side
+
+		NODISCARD std::optional<Event> TryPop()
+		{
+			Event event;
+			if (Take(std::span<Event>(&event, 1)) == 0)
+			{
+				return std::nullopt;
+			}
+			OnPopped(std::span<const Event>(&event, 1));
+			return event;
+		}
+
+		// Copies up to out.size() events into out, returns how many
+		u64 PopBatch(std::span<Event> out)
+		{
+			const u64 count = Take(out);
+			OnPopped(std::span<const Event>(out.first(count)));
+			return count;
+		}
+
+		// Replaces the contents of out with every pending event, reusing its capacity
+		u64 SwapOut(std::vector<Event>& out)
+		{
+			out.clear();
+			for (Event event; m_ring.TryPop(event);)
+			{
+				out.push_back(event);
+			}
+			if (m_spilled.load(std::memory_order_acquire) != 0)
+			{
+				std::lock_guard<std::mutex> lock(m_overflowMutex);
+				for (Event event; m_ring.TryPop(event);)
+				{
+					out.push_back(event);
+				}
+				out.insert(out.end(), m_overflow.begin(), m_overflow.end());
+				m_overflow.clear();
+				m_spilled.store(0, std::memory_order_release);
+			}
+			OnPopped(out);
+			return out.size();
+		}
+
+		void Clear()
+		{
+			for (Event event; m_ring.TryPop(event);)
+			{
+			}
+			if (m_spilled.load(std::memory_order_acquire) != 0)
+			{
+				std::lock_guard<std::mutex> lock(m_overflowMutex);
+				for (Event event; m_ring.TryPop(event);)
+				{
+				}
+				m_overflow.clear();
+				m_spilled.store(0, std::memory_order_release);
+			}
+			OnPopped({});
+		}
+
+		// Either side
+
+		NODISCARD u64 Size() const noexcept { return m_ring.Size() + m_spilled.load(std::memory_order_acquire); }
+		NODISCARD bool Empty() const noexcept { return Size() == 0; }
+
+		// Merges high-frequency input at enqueue time. Off by default
+		void SetCoalescing(bool enabled) noexcept { m_coalescing.store(enabled, std::memory_order_relaxed); }
+		NODISCARD bool IsCoalescing() const noexcept { return m_coalescing.load(std::memory_order_relaxed); }
+
+		NODISCARD EventMergeCounters GetMergeCounters() const noexcept { return m_coalescer.GetCounters(); }
+
+		// Dropped stays zero, HighWater counts the overflow as well as the ring
+		NODISCARD QueueCounters GetCounters() const noexcept
+		{
+			return
+			{
+				.Coalesced = m_coalescer.GetCounters().Total(),
+				.HighWater = m_highWater.load(std::memory_order_relaxed)
+			};
+		}
+
+		// Pushes, depth, rates, and latency from each event's timestamp to the poll that takes it.
+		// Events without a timestamp are neither timed nor counted as popped
+		QueueTelemetry& EnableTelemetry()
+		{
+			std::lock_guard<std::mutex> lock(m_telemetryMutex);
+			if (!m_telemetryStorage)
+			{
+				m_telemetryStorage = std::make_unique<QueueTelemetry>();
+				m_telemetryStorage->RecordDepth(Size());
+				m_telemetry.store(m_telemetryStorage.get(), std::memory_order_release);
+			}
+			return *m_telemetryStorage;
+		}
+
+		// Null until EnableTelemetry is called
+		NODISCARD QueueTelemetry* GetTelemetry() const noexcept { return m_telemetry.load(std::memory_order_acquire); }
+
+	private:
+		void Publish(const Event& event)
+		{
+			// Only the producer raises m_spilled, so reading zero here means the overflow really is empty
+			u64 depth = 0;
+			if (m_spilled.load(std::memory_order_relaxed) == 0 && m_ring.TryPush(event))
+			{
+				depth = m_ring.Size();
+			}
+			else
+			{
+				std::lock_guard<std::mutex> lock(m_overflowMutex);
+				if (m_overflow.empty() && m_ring.TryPush(event))
+				{
+					depth = m_ring.Size();
+				}
+				else
+				{
+					m_overflow.push_back(event);
+					m_spilled.store(m_overflow.size(), std::memory_order_release);
+					depth = m_ring.Size() + m_overflow.size();
+				}
+			}
+
+			if (depth > m_highWater.load(std::memory_order_relaxed))
+			{
+				m_highWater.store(depth, std::memory_order_relaxed);
+			}
+
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_acquire))
+			{
+				telemetry->RecordPush(depth, Timer::Now());
+				telemetry->PublishIfDue();
+			}
+		}
+
+		// Fills out from the ring, then from the overflow once the ring has run dry. While anything
+		// is spilled the producer leaves the ring alone, so whatever it still holds is older
+		u64 Take(std::span<Event> out)
+		{
+			u64 count = m_ring.TryPopBatch(out);
+			if (count == out.size() || m_spilled.load(std::memory_order_acquire) == 0)
+			{
+				return count;
+			}
+
+			std::lock_guard<std::mutex> lock(m_overflowMutex);
+			count += m_ring.TryPopBatch(out.subspan(count));
+			for (; count < out.size() && !m_overflow.empty(); ++count)
+			{
+				out[count] = m_overflow.front();
+				m_overflow.pop_front();
+			}
+			m_spilled.store(m_overflow.size(), std::memory_order_release);
+			return count;
+		}
+
+		void OnPopped(std::span<const Event> popped)
+		{
+			if (QueueTelemetry* telemetry = m_telemetry.load(std::memory_order_acquire))
+			{
+				telemetry->RecordPops(Size(), popped
+					| std::views::filter(&Event::HasTimestamp)
+					| std::views::transform(&Event::GetTimestamp), Timer::Now());
+				telemetry->PublishIfDue();
+			}
+		}
+
+	private:
+		SpscRingBuffer<Event, Capacity> m_ring;
+		WindowEventCoalescer            m_coalescer;  // Producer only
+		std::atomic<bool>               m_coalescing{ false };
+		std::atomic<u64>                m_highWater{ 0 };  // Written by the producer only
+
+		std::mutex                      m_overflowMutex;
+		std::deque<Event>               m_overflow;        // Guarded by m_overflowMutex
+		std::atomic<u64>                m_spilled{ 0 };    // m_overflow.size(), readable without the lock
+
+		std::mutex                      m_telemetryMutex;
+		std::unique_ptr<QueueTelemetry> m_telemetryStorage;
+		std::atomic<QueueTelemetry*>    m_telemetry{ nullptr };  // Set once by EnableTelemetry
+	};
+}
@@ -4,6 +4,7 @@
 #include <Elos/Window/WindowTypes.h>
 #include <Elos/Window/Input/KeyCode.h>
 #include <Elos/Event/Signal.h>
+#include <Elos/Utils/Timer.h>
 #include <variant>
 #include <type_traits>
 
@@ -12,6 +13,10 @@ namespace Elos
 	class Event
 	{
 	public:
+		// Held by a default-constructed Event, e.g. a buffer slot before PollEvents fills it. Not an
+		// event type: it is never queued and handlers never see it
+		struct None{};
+
 		struct Created{};
 		struct Closed{};
 		struct FocusLost{};
@@ -88,6 +93,7 @@ namespace Elos
 
 	private:
 		using EventVariant = std::variant<
+			None,
 			Closed,
 			FocusLost,
 			FocusGained,
@@ -121,12 +127,36 @@ namespace Elos
 			std::is_same<T, MouseLeft>>;
 
 	public:
+		// Index 0 is None, so per-type tables indexed by GetTypeIndex leave their first entry unused
+		static constexpr u32 TypeCount = static_cast<u32>(std::variant_size_v<EventVariant>);
+
+		// Holds None until assigned, so callers can keep buffers for PollEvents to fill
+		Event() = default;
+
 		template<typename T>
-		Event(const T& eventData) : m_eventData(eventData)
+		Event(const T& eventData, Timer::TimePoint timestamp = {}) : m_eventData(eventData), m_timestamp(timestamp)
 		{
 			static_assert(IsEventType<T>, "Invalid event type");
 		}
 
+		// When the window received the event, on Timer's clock. Input uses the time the OS queued the
+		// message, which only has the OS tick's resolution. Unset, i.e. the clock's epoch, until queued
+		NODISCARD Timer::TimePoint GetTimestamp() const noexcept { return m_timestamp; }
+		NODISCARD bool HasTimestamp() const noexcept { return m_timestamp != Timer::TimePoint{}; }
+		void SetTimestamp(Timer::TimePoint timestamp) noexcept { m_timestamp = timestamp; }
+
+		// Position of the event's type in the variant, below TypeCount
+		NODISCARD u32 GetTypeIndex() const noexcept { return static_cast<u32>(m_eventData.index()); }
+
+		template<typename T>
+		NODISCARD static constexpr u32 TypeIndexOf()
+		{
+			static_assert(IsEventType<T>, "Invalid event type");
+			return static_cast<u32>(EventVariant(std::in_place_type<T>).index());
+		}
+
+		NODISCARD bool IsEmpty() const noexcept { return std::holds_alternative<None>(m_eventData); }
+
 		// Type checking
 		template<typename T>
 		NODISCARD bool Is() const
@@ -143,7 +173,14 @@ namespace Elos
 			return std::get_if<T>(&m_eventData);
 		}
 
-		// Visit pattern
+		template<typename T>
+		NODISCARD T* Get()
+		{
+			static_assert(IsEventType<T>, "Invalid event type");
+			return std::get_if<T>(&m_eventData);
+		}
+
+		// Visit pattern. The visitor is called with None for an empty event
 		template<typename Visitor>
 		decltype(auto) visit(Visitor&& visitor)
 		{
@@ -157,25 +194,26 @@ namespace Elos
 		}
 
 	private:
-		EventVariant m_eventData;
+		EventVariant     m_eventData;
+		Timer::TimePoint m_timestamp{};
 	};
 
 	struct WindowEventSignals
 	{
-		Signal<const Event::Closed&>              OnClosed;
-		Signal<const Event::FocusLost&>           OnFocusLost;
-		Signal<const Event::FocusGained&>         OnFocusGained;
-		Signal<const Event::MouseEntered&>        OnMouseEntered;
-		Signal<const Event::MouseLeft&>           OnMouseLeft;
-		Signal<const Event::Resized&>             OnResized;
-		Signal<const Event::TextInput&>           OnTextInput;
-		Signal<const Event::KeyPressed&>          OnKeyPressed;
-		Signal<const Event::KeyReleased&>         OnKeyReleased;
-		Signal<const Event::MouseWheelScrolled&>  OnMouseWheelScrolled;
-		Signal<const Event::MouseButtonPressed&>  OnMouseButtonPressed;
-		Signal<const Event::MouseButtonReleased&> OnMouseButtonReleased;
-		Signal<const Event::MouseMoved&>          OnMouseMoved;
-		Signal<const Event::MouseMovedRaw&>       OnMouseMovedRaw;
+		Signal<const Event::Closed&>              OnClosed{ "Window.OnClosed" };
+		Signal<const Event::FocusLost&>           OnFocusLost{ "Window.OnFocusLost" };
+		Signal<const Event::FocusGained&>         OnFocusGained{ "Window.OnFocusGained" };
+		Signal<const Event::MouseEntered&>        OnMouseEntered{ "Window.OnMouseEntered" };
+		Signal<const Event::MouseLeft&>           OnMouseLeft{ "Window.OnMouseLeft" };
+		Signal<const Event::Resized&>             OnResized{ "Window.OnResized" };
+		Signal<const Event::TextInput&>           OnTextInput{ "Window.OnTextInput" };
+		Signal<const Event::KeyPressed&>          OnKeyPressed{ "Window.OnKeyPressed" };
+		Signal<const Event::KeyReleased&>         OnKeyReleased{ "Window.OnKeyReleased" };
+		Signal<const Event::MouseWheelScrolled&>  OnMouseWheelScrolled{ "Window.OnMouseWheelScrolled" };
+		Signal<const Event::MouseButtonPressed&>  OnMouseButtonPressed{ "Window.OnMouseButtonPressed" };
+		Signal<const Event::MouseButtonReleased&> OnMouseButtonReleased{ "Window.OnMouseButtonReleased" };
+		Signal<const Event::MouseMoved&>          OnMouseMoved{ "Window.OnMouseMoved" };
+		Signal<const Event::MouseMovedRaw&>       OnMouseMovedRaw{ "Window.OnMouseMovedRaw" };
 
 		void DisconnectAll()
 		{
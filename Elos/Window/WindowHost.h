@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Elos/Export.h>
+#include <Elos/Window/BasicWindowHost.h>
+#include <memory>
+#include <tuple>
+#include <Windows.h>
+#include <Objbase.h>
+
+namespace Elos
+{
+    class WindowThread;
+
+    namespace Internal
+    {
+        // The host thread's message queue and an auto-reset event for commands, waited on together
+        class Win32MessageSource
+        {
+        public:
+            Win32MessageSource() : m_commandEvent(::CreateEventW(nullptr, FALSE, FALSE, nullptr)) {}
+            ~Win32MessageSource() { ::CloseHandle(m_commandEvent); }
+
+            Win32MessageSource(const Win32MessageSource&) = delete;
+            Win32MessageSource& operator=(const Win32MessageSource&) = delete;
+
+            void EnterThread() { std::ignore = ::CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED); }
+            void LeaveThread() { ::CoUninitialize(); }
+
+            bool PumpMessages()
+            {
+                MSG msg{};
+                while (::PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+                {
+                    if (msg.message == WM_QUIT)
+                        return false;
+
+                    ::TranslateMessage(&msg);
+                    ::DispatchMessage(&msg);
+                }
+                return true;
+            }
+
+            // MWMO_INPUTAVAILABLE also returns for input that arrived before the wait
+            void Wait() { ::MsgWaitForMultipleObjectsEx(1, &m_commandEvent, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE); }
+            void Signal() { ::SetEvent(m_commandEvent); }
+
+        private:
+            HANDLE m_commandEvent;
+        };
+    }
+
+    // A thread that runs any number of windows. Pass one in WindowCreateInfo::Host to put several
+    // top-level windows on the same thread; children join their parent's host unless given another
+    class ELOS_API WindowHost final : public BasicWindowHost<Internal::Win32MessageSource, WindowThread>
+    {
+    public:
+        WindowHost();
+        ~WindowHost();
+
+        NODISCARD static std::shared_ptr<WindowHost> Create();
+    };
+
+    using WindowHostPool = BasicWindowHostPool<WindowHost>;
+    using WindowCommandBatch = BasicWindowCommandBatch<WindowHost>;
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <Elos/Common/StandardTypes.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <atomic>
+#include <concepts>
+#include <utility>
+
+namespace Elos
+{
+	// The platform half of a WindowLoop: the thread's message queue plus one signal, waited on together
+	template <typename T>
+	concept WindowMessageSource = requires(T& source)
+	{
+		{ source.PumpMessages() } -> std::same_as<bool>;  // Dispatches every pending message, false once the thread should quit
+		source.Wait();                                    // Blocks until a message arrives or Signal is called. A Signal before Wait makes it return at once
+		source.Signal();                                  // Callable from any thread
+	};
+
+	/**
+	 * @brief Run loop of a window thread that sleeps until there is work
+	 *
+	 * Each pass runs the queued commands, dispatches pending messages, then blocks in the source's
+	 * single wait until a message arrives or another thread calls Notify. Notify only signals the
+	 * source if the loop hasn't been woken since its last pass began, so a burst of commands costs
+	 * one signal and an idle window never wakes.
+	 */
+	template <WindowMessageSource Source>
+	class WindowLoop
+	{
+	public:
+		explicit WindowLoop(Source& source) : m_source(source) {}
+
+		WindowLoop(const WindowLoop&) = delete;
+		WindowLoop& operator=(const WindowLoop&) = delete;
+
+		// Returns once Stop is called or the source reports quit
+		template <typename ProcessCommands>
+		void Run(ProcessCommands&& processCommands)
+		{
+			Run(std::forward<ProcessCommands>(processCommands), [] {});
+		}
+
+		// afterMessages runs once the pass's messages have been dispatched, before the loop waits
+		template <typename ProcessCommands, typename AfterMessages>
+		void Run(ProcessCommands&& processCommands, AfterMessages&& afterMessages)
+		{
+			while (m_running.load(std::memory_order_acquire))
+			{
+				// Commands queued after this exchange signal again; ones queued before it are visible to the drain
+				m_wakePending.exchange(false, std::memory_order_acq_rel);
+				m_passes.fetch_add(1, std::memory_order_relaxed);
+
+				processCommands();
+				const bool pumping = m_source.PumpMessages();
+				afterMessages();
+				if (!pumping || !m_running.load(std::memory_order_acquire))
+				{
+					break;
+				}
+
+				m_source.Wait();
+			}
+			m_running.store(false, std::memory_order_release);
+		}
+
+		// Call after queuing a command, from any thread
+		void Notify()
+		{
+			if (!m_wakePending.exchange(true, std::memory_order_acq_rel))
+			{
+				m_source.Signal();
+			}
+		}
+
+		// Makes Run return after its current pass
+		void Stop()
+		{
+			m_running.store(false, std::memory_order_release);
+			m_source.Signal();
+		}
+
+		NODISCARD bool IsRunning() const noexcept { return m_running.load(std::memory_order_acquire); }
+
+		// Passes through the loop so far, i.e. how often the thread has woken
+		NODISCARD u64 GetPassCount() const noexcept { return m_passes.load(std::memory_order_relaxed); }
+
+	private:
+		Source&           m_source;
+		std::atomic<bool> m_running{ true };
+		std::atomic<bool> m_wakePending{ false };
+		std::atomic<u64>  m_passes{ 0 };
+	};
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Elos/Window/BasicWindowPool.h>
+#include <Elos/Window/Window.h>
+
+namespace Elos
+{
+    // Keeps hidden windows warm so popups, tooltips and dialogs appear without waiting for creation
+    using WindowPool = BasicWindowPool<Window>;
+}
@@ -2,37 +2,55 @@
 
 #include <Elos/Export.h>
 #include <Elos/Window/Window.h>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
-#include <queue>
-#include <any>
-#include <future>
-#include <atomic>
+#include <Elos/Window/WindowHost.h>
+#include <memory>
 #include <Windows.h>
-#include <Objbase.h>
 
 namespace Elos
 {
+    // A window's state on its host thread: runs the window's commands and turns its messages into events
     class ELOS_API WindowThread
     {
     public:
-        WindowThread(Window* window);
+        WindowThread(Window* window, std::shared_ptr<WindowHost> host);
         ~WindowThread();
 
-        void QueueCommand(Window::CommandType type, std::any data);
-        void QueueCommandAndWait(Window::CommandType type, std::any data);
+        void QueueCommand(WindowCommand::Payload data);
+        void QueueCommandAndWait(WindowCommand::Payload data);
+        QueueTelemetry& EnableCommandQueueTelemetry() { return m_host->EnableCommandQueueTelemetry(); }
+        u64 GetElidedCommandCount() const { return m_host->GetElidedCommandCount(m_id); }
+        const std::shared_ptr<WindowHost>& GetHost() const { return m_host; }
+        WindowId GetId() const { return m_id; }
         HWND GetHandle() const { return m_handle; }
         void SetHandle(HWND handle) { m_handle = handle; }
         LRESULT ProcessMessage(UINT msg, WPARAM wParam, LPARAM lParam);
 
     private:
-        void ThreadMain();
-
-        void ProcessCommands();
-        void ProcessCommand(const Window::Command& cmd);
+        friend class BasicWindowHost<Internal::Win32MessageSource, WindowThread>;
+
+        // One overload per WindowCommand payload, run on the host thread
+        void Execute(const WindowCommand::Create& cmd);
+        void Execute(const WindowCommand::Close& cmd);
+        void Execute(const WindowCommand::SetPosition& cmd);
+        void Execute(const WindowCommand::SetSize& cmd);
+        void Execute(const WindowCommand::SetTitle& cmd);
+        void Execute(const WindowCommand::SetVisible& cmd);
+        void Execute(const WindowCommand::RequestFocus& cmd);
+        void Execute(const WindowCommand::Redraw& cmd);
 
         void CreateWindowOnThread(const WindowCreateInfo& info);
+        void PublishPosition();
+
+        // Coalesced events are published once the host has dispatched the pass's messages
+        void RequestEventFlush();
+        void FlushEvents();
+
+        Timer::TimePoint GetReceiptTime(UINT msg) const;
+
+        // The host thread is the state block's only writer
+        template <typename Updater>
+        void PublishState(Updater&& update) { m_window->m_state.Update(std::forward<Updater>(update)); }
+
         DWORD GetWin32WindowStyle(WindowStyle style, WindowChildMode childMode) const;
         WindowSize ContentSizeToWindowSize(const WindowSize& size) const;
 
@@ -40,198 +58,109 @@ namespace Elos
 
     private:
         Window*                     m_window;
-        std::thread                 m_thread;
-        std::atomic<bool>           m_running{ true };
-        std::queue<Window::Command> m_commandQueue;
-        std::mutex                  m_commandMutex;
-        std::condition_variable     m_commandCV;
+        std::shared_ptr<WindowHost> m_host;
+        WindowId                    m_id;
         HWND                        m_handle = nullptr;
+        bool                        m_flushRequested = false;
+        bool                        m_inSizeMove = false;  // The host loop is stalled in a modal move or resize
+
+        // Older message times are taken as a clock mismatch and replaced by the time of handling
+        static constexpr DWORD s_maxMessageAgeMs = 10'000;
     };
 
-    inline WindowThread::WindowThread(Window* window)
+    inline WindowThread::WindowThread(Window* window, std::shared_ptr<WindowHost> host)
         : m_window(window)
+        , m_host(std::move(host))
     {
-        // Start the window thread
-        m_thread = std::thread(&WindowThread::ThreadMain, this);
+        m_id = m_host->Attach(*this);
     }
 
     inline WindowThread::~WindowThread()
     {
-        // Signal thread to stop
-        m_running = false;
+        // Commands still queued for this window are dropped. The host's thread stops with its last window
+        m_host->Detach(m_id);
+    }
 
-        // Wake up thread
-        {
-            std::unique_lock<std::mutex> lock(m_commandMutex);
-            m_commandCV.notify_all();
-        }
+    inline void WindowThread::QueueCommand(WindowCommand::Payload data)
+    {
+        m_host->Post(m_id, std::move(data));
+    }
 
-        // Join thread
-        if (m_thread.joinable())
-            m_thread.join();
+    inline void WindowThread::QueueCommandAndWait(WindowCommand::Payload data)
+    {
+        m_host->PostAndWait(m_id, std::move(data));
     }
 
-    inline void WindowThread::QueueCommand(Window::CommandType type, std::any data)
+    inline void WindowThread::Execute(const WindowCommand::Create& cmd)
     {
-        Window::Command cmd{ type, data };
+        CreateWindowOnThread(cmd.Info);
+    }
 
+    inline void WindowThread::Execute(const WindowCommand::Close&)
+    {
+        if (m_handle)
         {
-            std::unique_lock<std::mutex> lock(m_commandMutex);
-            m_commandQueue.push(cmd);
+            ::DestroyWindow(m_handle);
+            m_handle = nullptr;
+            m_window->m_handle = nullptr;
+            PublishState([](WindowState& state)
+            {
+                state.Open    = false;
+                state.Visible = false;
+                state.Focused = false;
+            });
         }
-
-        m_commandCV.notify_one();
     }
 
-    inline void WindowThread::QueueCommandAndWait(Window::CommandType type, std::any data)
+    inline void WindowThread::Execute(const WindowCommand::SetPosition& cmd)
     {
-        std::promise<void> promise;
-        std::future<void> future = promise.get_future();
-
-        Window::Command cmd{ type, data, &promise };
+        if (m_handle)
+            ::SetWindowPos(m_handle, nullptr, cmd.Position.X, cmd.Position.Y, 0, 0, SWP_NOSIZE | SWP_NOZORDER);
+    }
 
+    inline void WindowThread::Execute(const WindowCommand::SetSize& cmd)
+    {
+        if (m_handle)
         {
-            std::unique_lock<std::mutex> lock(m_commandMutex);
-            m_commandQueue.push(cmd);
-        }
+            auto winSize = ContentSizeToWindowSize(cmd.Size);
+            ::SetWindowPos(m_handle, nullptr, 0, 0, winSize.Width, winSize.Height, SWP_NOMOVE | SWP_NOZORDER);
 
-        m_commandCV.notify_one();
-        future.wait(); // Wait for command to complete
+            // Update the window's size
+            PublishState([&](WindowState& state) { state.Size = cmd.Size; });
+        }
     }
 
-    inline void WindowThread::ThreadMain()
+    inline void WindowThread::Execute(const WindowCommand::SetTitle& cmd)
     {
-        // Initialize COM for this thread
-        std::ignore = CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
-
-        // Create message loop
-        MSG msg{};
-
-        while (m_running)
+        if (m_handle)
         {
-            // Process commands from the main thread
-            ProcessCommands();
-
-            // Process window messages
-            while (::PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
-            {
-                if (msg.message == WM_QUIT)
-                {
-                    m_running = false;
-                    break;
-                }
-
-                ::TranslateMessage(&msg);
-                ::DispatchMessage(&msg);
-            }
-
-            // Don't burn CPU
-            if (m_commandQueue.empty())
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ::SetWindowTextW(m_handle, StringToWString(cmd.Title).c_str());
+            m_window->m_title.assign(cmd.Title.View());
         }
-
-        // Cleanup COM
-        CoUninitialize();
     }
 
-    inline void WindowThread::ProcessCommands()
+    inline void WindowThread::Execute(const WindowCommand::SetVisible& cmd)
     {
-        std::unique_lock<std::mutex> lock(m_commandMutex);
+        if (m_handle)
+            ::ShowWindow(m_handle, cmd.Visible ? SW_SHOW : SW_HIDE);
+    }
 
-        // Process all commands
-        while (!m_commandQueue.empty())
+    inline void WindowThread::Execute(const WindowCommand::RequestFocus&)
+    {
+        if (m_handle)
         {
-            Window::Command cmd = m_commandQueue.front();
-            m_commandQueue.pop();
-
-            // Release lock during command processing
-            lock.unlock();
-            ProcessCommand(cmd);
-            lock.lock();
+            ::SetForegroundWindow(m_handle);
+            ::SetFocus(m_handle);
         }
     }
 
-    inline void WindowThread::ProcessCommand(const Window::Command& cmd)
+    inline void WindowThread::Execute(const WindowCommand::Redraw&)
     {
-        try
-        {
-            switch (cmd.type)
-            {
-            case Window::CommandType::Create:
-                CreateWindowOnThread(std::any_cast<WindowCreateInfo>(cmd.data));
-                break;
-
-            case Window::CommandType::Close:
-                if (m_handle)
-                {
-                    ::DestroyWindow(m_handle);
-                    m_handle = nullptr;
-                    m_window->m_handle = nullptr;
-                }
-                break;
-
-            case Window::CommandType::SetPosition:
-                if (m_handle)
-                {
-                    auto pos = std::any_cast<WindowPosition>(cmd.data);
-                    ::SetWindowPos(m_handle, nullptr, pos.X, pos.Y, 0, 0, SWP_NOSIZE | SWP_NOZORDER);
-                }
-                break;
-
-            case Window::CommandType::SetSize:
-                if (m_handle)
-                {
-                    auto size = std::any_cast<WindowSize>(cmd.data);
-                    auto winSize = ContentSizeToWindowSize(size);
-                    ::SetWindowPos(m_handle, nullptr, 0, 0, winSize.Width, winSize.Height, SWP_NOMOVE | SWP_NOZORDER);
-
-                    // Update the window's size
-                    m_window->m_size = size;
-                }
-                break;
-
-            case Window::CommandType::SetTitle:
-                if (m_handle)
-                {
-                    auto title = std::any_cast<String>(cmd.data);
-                    ::SetWindowTextW(m_handle, StringToWString(title).c_str());
-                    m_window->m_title = title;
-                }
-                break;
-
-            case Window::CommandType::SetVisible:
-                if (m_handle)
-                {
-                    auto visible = std::any_cast<bool>(cmd.data);
-                    ::ShowWindow(m_handle, visible ? SW_SHOW : SW_HIDE);
-                }
-                break;
-
-            case Window::CommandType::RequestFocus:
-                if (m_handle)
-                {
-                    ::SetForegroundWindow(m_handle);
-                    ::SetFocus(m_handle);
-                }
-                break;
-
-            case Window::CommandType::Redraw:
-                if (m_handle)
-                {
-                    ::InvalidateRect(m_handle, nullptr, TRUE);
-                    ::UpdateWindow(m_handle);
-                }
-                break;
-            }
-        }
-        catch (const std::exception& e)
+        if (m_handle)
         {
-            throw e;
+            ::InvalidateRect(m_handle, nullptr, TRUE);
+            ::UpdateWindow(m_handle);
         }
-
-        // Signal completion
-        if (cmd.completion)
-            cmd.completion->set_value();
     }
 
     inline void WindowThread::CreateWindowOnThread(const WindowCreateInfo& createInfo)
@@ -288,6 +217,8 @@ namespace Elos
         }
 
         DWORD win32Style             = GetWin32WindowStyle(createInfo.Style, createInfo.ChildMode);
+        if (!createInfo.Visible)
+            win32Style &= ~WS_VISIBLE;
         const WindowSize& windowSize = ContentSizeToWindowSize(createInfo.Size);
 
         m_handle = ::CreateWindowEx(
@@ -319,12 +250,66 @@ namespace Elos
 
             ++m_window->s_windowCount;
 
-            ::ShowWindow(m_handle, SW_SHOW);
+            if (createInfo.Visible)
+                ::ShowWindow(m_handle, SW_SHOW);
+
+            // Everything else is kept current by the messages that change it
+            RECT rect;
+            ::GetWindowRect(m_handle, &rect);
+            PublishState([&](WindowState& state)
+            {
+                state.Size      = createInfo.Size;
+                state.Position  = { static_cast<i32>(rect.left), static_cast<i32>(rect.top) };
+                state.Dpi       = ::GetDpiForWindow(m_handle);
+                state.Open      = true;
+                state.Visible   = ::IsWindowVisible(m_handle) != FALSE;
+                state.Focused   = ::GetFocus() == m_handle;
+                state.Minimized = ::IsIconic(m_handle) != FALSE;
+            });
+        }
+    }
+
+    inline void WindowThread::PublishPosition()
+    {
+        RECT rect;
+        ::GetWindowRect(m_handle, &rect);
+        PublishState([&](WindowState& state) { state.Position = { static_cast<i32>(rect.left), static_cast<i32>(rect.top) }; });
+    }
 
-            m_window->m_size = createInfo.Size;
+    inline void WindowThread::RequestEventFlush()
+    {
+        // A modal move or resize loop doesn't return to the host until it ends
+        if (m_inSizeMove)
+        {
+            FlushEvents();
+        }
+        else if (!m_flushRequested)
+        {
+            m_flushRequested = true;
+            m_host->DeferFlush(m_id);
         }
     }
 
+    inline void WindowThread::FlushEvents()
+    {
+        m_flushRequested = false;
+        m_window->m_events.Flush();
+    }
+
+    inline Timer::TimePoint WindowThread::GetReceiptTime(UINT msg) const
+    {
+        const Timer::TimePoint now = Timer::Now();
+
+        // Only posted input carries its own time; a sent message reports the time of the last one retrieved
+        const bool input = (msg >= WM_KEYFIRST && msg <= WM_KEYLAST) || (msg >= WM_MOUSEFIRST && msg <= WM_MOUSELAST) || msg == WM_INPUT;
+        if (!input || ::InSendMessage())
+            return now;
+
+        // Message times are GetTickCount milliseconds and wrap with it
+        const DWORD age = ::GetTickCount() - static_cast<DWORD>(::GetMessageTime());
+        return age < s_maxMessageAgeMs ? now - std::chrono::milliseconds(age) : now;
+    }
+
     inline DWORD WindowThread::GetWin32WindowStyle(WindowStyle style, WindowChildMode childMode) const
     {
         DWORD win32Style = 0;
@@ -429,33 +414,68 @@ namespace Elos
             }
         }
 
+        // Stamped before handling, since handling can send further messages through here
+        const Timer::TimePoint received = GetReceiptTime(msg);
+        const auto pushEvent = [&](Event event)
+        {
+            event.SetTimestamp(received);
+            m_window->PushEvent(event);
+        };
+
         // Process all other messages and generate events
         switch (msg)
         {
         case WM_CLOSE:
-            m_window->PushEvent(Event::Closed{});
+            pushEvent(Event::Closed{});
             return 0;
 
         case WM_SIZE:
-            if (wParam != SIZE_MINIMIZED)
+        {
+            const WindowState state = m_window->m_state.Load();
+            if (wParam == SIZE_MINIMIZED)
             {
-                const u32 width = static_cast<u32>(LOWORD(lParam));
-                const u32 height = static_cast<u32>(HIWORD(lParam));
+                if (!state.Minimized)
+                    PublishState([](WindowState& published) { published.Minimized = true; });
+                break;
+            }
+
+            const u32 width = static_cast<u32>(LOWORD(lParam));
+            const u32 height = static_cast<u32>(HIWORD(lParam));
+            const bool resized = state.Size.Width != width || state.Size.Height != height;
 
-                if (m_window->m_size.Width != width || m_window->m_size.Height != height)
+            if (resized || state.Minimized)
+            {
+                PublishState([&](WindowState& published)
                 {
-                    m_window->m_size = { width, height };
-                    m_window->PushEvent(Event::Resized{ width, height });
-                }
+                    published.Size      = { width, height };
+                    published.Minimized = false;
+                });
             }
+            if (resized)
+                pushEvent(Event::Resized{ width, height });
+            break;
+        }
+
+        case WM_MOVE:
+            PublishPosition();
+            break;
+
+        case WM_SHOWWINDOW:
+            PublishState([&](WindowState& state) { state.Visible = wParam != FALSE; });
+            break;
+
+        case WM_DPICHANGED:
+            PublishState([&](WindowState& state) { state.Dpi = LOWORD(wParam); });
             break;
 
         case WM_SETFOCUS:
-            m_window->PushEvent(Event::FocusGained{});
+            PublishState([](WindowState& state) { state.Focused = true; });
+            pushEvent(Event::FocusGained{});
             break;
 
         case WM_KILLFOCUS:
-            m_window->PushEvent(Event::FocusLost{});
+            PublishState([](WindowState& state) { state.Focused = false; });
+            pushEvent(Event::FocusLost{});
             break;
 
         case WM_CHAR:
@@ -480,14 +500,14 @@ namespace Elos
                         if (MultiByteToWideChar(CP_UTF8, 0, reinterpret_cast<const char*>(utf16), 4,
                             reinterpret_cast<LPWSTR>(&utf32), 4))
                         {
-                            m_window->PushEvent(Event::TextInput{ utf32 });
+                            pushEvent(Event::TextInput{ utf32 });
                         }
                         m_window->m_surrogate = 0;
                     }
                     else
                     {
                         // Single character
-                        m_window->PushEvent(Event::TextInput{ character });
+                        pushEvent(Event::TextInput{ character });
                     }
                 }
             }
@@ -503,7 +523,7 @@ namespace Elos
                 event.Control = HIWORD(GetKeyState(VK_CONTROL)) != 0;
                 event.Shift   = HIWORD(GetKeyState(VK_SHIFT)) != 0;
                 event.System  = HIWORD(GetKeyState(VK_LWIN)) || HIWORD(GetKeyState(VK_RWIN));
-                m_window->PushEvent(event);
+                pushEvent(event);
             }
             break;
 
@@ -517,7 +537,7 @@ namespace Elos
                 event.Control = HIWORD(GetKeyState(VK_CONTROL)) != 0;
                 event.Shift   = HIWORD(GetKeyState(VK_SHIFT)) != 0;
                 event.System  = HIWORD(GetKeyState(VK_LWIN)) || HIWORD(GetKeyState(VK_RWIN));
-                m_window->PushEvent(event);
+                pushEvent(event);
             }
             break;
 
@@ -530,7 +550,7 @@ namespace Elos
             ScreenToClient(m_handle, &position);
 
             auto delta = static_cast<SHORT>(HIWORD(wParam));
-            m_window->PushEvent(Event::MouseWheelScrolled
+            pushEvent(Event::MouseWheelScrolled
             {
                 KeyCode::MouseWheel::Vertical,
                 static_cast<f32>(delta) / WHEEL_DELTA,
@@ -549,7 +569,7 @@ namespace Elos
             ScreenToClient(m_handle, &position);
 
             auto delta = static_cast<SHORT>(HIWORD(wParam));
-            m_window->PushEvent(Event::MouseWheelScrolled
+            pushEvent(Event::MouseWheelScrolled
             {
                 KeyCode::MouseWheel::Horizontal,
                 static_cast<f32>(delta) / WHEEL_DELTA,
@@ -561,7 +581,7 @@ namespace Elos
 
         case WM_LBUTTONDOWN:
         {
-            m_window->PushEvent(Event::MouseButtonPressed
+            pushEvent(Event::MouseButtonPressed
             {
                 KeyCode::MouseButton::Left,
                 static_cast<i32>(LOWORD(lParam)),
@@ -572,7 +592,7 @@ namespace Elos
 
         case WM_LBUTTONUP:
         {
-            m_window->PushEvent(Event::MouseButtonReleased
+            pushEvent(Event::MouseButtonReleased
             {
                 KeyCode::MouseButton::Left,
                 static_cast<i32>(LOWORD(lParam)),
@@ -583,7 +603,7 @@ namespace Elos
 
         case WM_RBUTTONDOWN:
         {
-            m_window->PushEvent(Event::MouseButtonPressed
+            pushEvent(Event::MouseButtonPressed
             {
                 KeyCode::MouseButton::Right,
                 static_cast<i32>(LOWORD(lParam)),
@@ -594,7 +614,7 @@ namespace Elos
 
         case WM_RBUTTONUP:
         {
-            m_window->PushEvent(Event::MouseButtonReleased
+            pushEvent(Event::MouseButtonReleased
             {
                 KeyCode::MouseButton::Right,
                 static_cast<i32>(LOWORD(lParam)),
@@ -605,7 +625,7 @@ namespace Elos
 
         case WM_MBUTTONDOWN:
         {
-            m_window->PushEvent(Event::MouseButtonPressed
+            pushEvent(Event::MouseButtonPressed
             {
                 KeyCode::MouseButton::Middle,
                 static_cast<i32>(LOWORD(lParam)),
@@ -616,7 +636,7 @@ namespace Elos
 
         case WM_MBUTTONUP:
         {
-            m_window->PushEvent(Event::MouseButtonReleased
+            pushEvent(Event::MouseButtonReleased
             {
                 KeyCode::MouseButton::Middle,
                 static_cast<i32>(LOWORD(lParam)),
@@ -627,7 +647,7 @@ namespace Elos
 
         case WM_XBUTTONDOWN:
         {
-            m_window->PushEvent(Event::MouseButtonPressed
+            pushEvent(Event::MouseButtonPressed
             {
                 HIWORD(wParam) == XBUTTON1 ? KeyCode::MouseButton::Extra1 : KeyCode::MouseButton::Extra2,
                 static_cast<i32>(LOWORD(lParam)),
@@ -638,7 +658,7 @@ namespace Elos
 
         case WM_XBUTTONUP:
         {
-            m_window->PushEvent(Event::MouseButtonReleased
+            pushEvent(Event::MouseButtonReleased
             {
                 HIWORD(wParam) == XBUTTON1 ? KeyCode::MouseButton::Extra1 : KeyCode::MouseButton::Extra2,
                 static_cast<i32>(LOWORD(lParam)),
@@ -673,7 +693,7 @@ namespace Elos
                 if (m_window->m_mouse->IsInside())
                 {
                     m_window->m_mouse->m_isInside = false;
-                    m_window->PushEvent(Event::MouseLeft{});
+                    pushEvent(Event::MouseLeft{});
                 }
             }
             else
@@ -681,11 +701,11 @@ namespace Elos
                 if (!m_window->m_mouse->IsInside())
                 {
                     m_window->m_mouse->m_isInside = true;
-                    m_window->PushEvent(Event::MouseEntered{});
+                    pushEvent(Event::MouseEntered{});
                 }
             }
 
-            m_window->PushEvent(Event::MouseMoved{ x, y });
+            pushEvent(Event::MouseMoved{ x, y });
             break;
         }
 
@@ -698,7 +718,7 @@ namespace Elos
             {
                 if (input.header.dwType == RIM_TYPEMOUSE && (input.data.mouse.usFlags & 0x01) == MOUSE_MOVE_RELATIVE)
                 {
-                    m_window->PushEvent(Event::MouseMovedRaw{ input.data.mouse.lLastX, input.data.mouse.lLastY });
+                    pushEvent(Event::MouseMovedRaw{ input.data.mouse.lLastX, input.data.mouse.lLastY });
                 }
             }
             break;
@@ -711,8 +731,19 @@ namespace Elos
             lpMMI->ptMinTrackSize.y = m_window->m_minimumSize.Height;
         }
             break;
+
+        case WM_ENTERSIZEMOVE:
+            m_inSizeMove = true;
+            break;
+
+        case WM_EXITSIZEMOVE:
+            m_inSizeMove = false;
+            break;
         }
 
+        if (m_window->m_events.HasHeldEvents())
+            RequestEventFlush();
+
         return ::DefWindowProc(m_handle, msg, wParam, lParam);
     }
 
@@ -1,10 +1,17 @@
 #pragma once
 #include <Elos/Common/StandardTypes.h>
 #include <Elos/Common/EnumFlags.h>
+#include <Elos/Common/StringTypes.h>
 #include <memory>
 
 namespace Elos
 {
+	class Window;
+	class WindowHost;
+
+	// Identifies a window on its host, assigned when the window attaches
+	using WindowId = u32;
+
 	enum class WindowStyle : u8
 	{
 		None     = 0,  // Non-resizable 'splashscreen' style window
@@ -36,14 +43,31 @@ namespace Elos
 		i32 Y;
 	};
 
+	// What the window thread last reported about a window, published as one consistent snapshot
+	struct WindowState
+	{
+		WindowSize     Size{ 0, 0 };      // Content area
+		WindowPosition Position{ 0, 0 };  // Top-left of the whole window, in screen coordinates
+		u32            Dpi       = 96;
+		bool           Open      = false;
+		bool           Visible   = false;
+		bool           Focused   = false;
+		bool           Minimized = false;
+	};
+
+	// Lets the system place the window, the same values as CW_USEDEFAULT
+	inline constexpr WindowPosition DefaultWindowPosition{ static_cast<i32>(0x80000000), static_cast<i32>(0x80000000) };
+
 	struct WindowCreateInfo
 	{
 		String Title;
 		WindowSize Size;
 		WindowStyle Style{ WindowStyle::Default };
 		WindowChildMode ChildMode{ WindowChildMode::None };
-		WindowPosition Position{ static_cast<i32>(0x80000000), static_cast<i32>(0x80000000) };  // Same values as CW_USEDEFAULT
+		WindowPosition Position{ DefaultWindowPosition };
 		std::shared_ptr<Window> Parent{ nullptr };
+		std::shared_ptr<WindowHost> Host{ nullptr };  // Thread to run on. Null joins the parent's host, or gives a top-level window a thread of its own
+		bool Visible{ true };  // False creates the window hidden, e.g. to keep it warm in a WindowPool
 
 		// Default window create info (non-child, main window)
 		static WindowCreateInfo Default(const String& title, const WindowSize& size, WindowStyle style = WindowStyle::Default)
@@ -0,0 +1,906 @@
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <Elos/Containers/QueueSet.h>
+#include <Elos/Containers/ThreadSafePriorityQueue.h>
+#include <Elos/Containers/ThreadSafeDeadlineQueue.h>
+#include <Elos/Containers/PairingHeap.h>
+#include <Elos/Containers/SpscRingBuffer.h>
+#include <Elos/Containers/MpmcQueue.h>
+#include <Elos/Containers/SeqLock.h>
+#include <print>
+#include <cassert>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	const auto TestThreadSafeQueue = []()
+	{
+		std::println("Testing ThreadSafeQueue with move-only items");
+
+		Elos::ThreadSafeQueue<std::unique_ptr<int>> queue;
+		queue.Push(std::make_unique<int>(1));
+		queue.Emplace(new int(2));
+
+		std::vector<std::unique_ptr<int>> batch;
+		batch.push_back(std::make_unique<int>(3));
+		batch.push_back(std::make_unique<int>(4));
+		queue.PushRange(std::move(batch));
+		assert(queue.Size() == 4 && "Push, Emplace and PushRange should all enqueue");
+
+		std::optional<std::unique_ptr<int>> front = queue.TryPop();
+		assert(front && **front == 1 && "TryPop should move the front item out");
+		assert(*queue.WaitAndPop() == 2 && "WaitAndPop should move the front item out");
+
+		std::vector<std::unique_ptr<int>> drained;
+		assert(queue.DrainTo(std::back_inserter(drained)) == 2 && queue.Empty() && "DrainTo should take every item");
+		assert(*drained[0] == 3 && *drained[1] == 4 && "DrainTo should keep FIFO order");
+
+		// SwapOut replaces the previous contents and keeps the vector's capacity
+		const std::vector<int> values{ 5, 6, 7 };
+		Elos::ThreadSafeQueue<int> ints;
+		ints.PushRange(values);
+		std::vector<int> out{ 0 };
+		out.reserve(16);
+		const int* storage = out.data();
+		assert(ints.SwapOut(out) == 3 && out == values && "SwapOut should replace the vector's contents");
+		assert(out.data() == storage && "SwapOut should reuse the vector's storage");
+		assert(ints.SwapOut(out) == 0 && out.empty() && "SwapOut on an empty queue should clear the vector");
+
+		std::println("ThreadSafeQueue move-only items passed!");
+	};
+
+	const auto TestBoundedQueue = []()
+	{
+		std::println("Testing bounded ThreadSafeQueue policies");
+
+		Elos::ThreadSafeQueue<int> dropOldest(2, Elos::QueueOverflowPolicy::DropOldest);
+		dropOldest.PushRange(std::vector<int>{ 1, 2, 3, 4 });
+		assert(dropOldest.TryPop() == 3 && dropOldest.TryPop() == 4 && "DropOldest should keep the newest items");
+		assert(dropOldest.GetCounters().Dropped == 2 && dropOldest.GetCounters().HighWater == 2 && "DropOldest should count drops");
+
+		Elos::ThreadSafeQueue<int> dropNewest(2, Elos::QueueOverflowPolicy::DropNewest);
+		dropNewest.PushRange(std::vector<int>{ 1, 2, 3, 4 });
+		assert(dropNewest.TryPop() == 1 && dropNewest.TryPop() == 2 && "DropNewest should keep the oldest items");
+		assert(dropNewest.GetCounters().Dropped == 2 && "DropNewest should count drops");
+
+		// Even numbers are summed into an even tail, anything else falls back to dropping the oldest
+		Elos::ThreadSafeQueue<int> coalesce(2, Elos::QueueOverflowPolicy::Coalesce, [](int& last, const int& incoming)
+		{
+			if (last % 2 != 0 || incoming % 2 != 0)
+			{
+				return false;
+			}
+			last += incoming;
+			return true;
+		});
+		coalesce.PushRange(std::vector<int>{ 1, 2, 4, 6, 3 });
+		const Elos::QueueCounters counters = coalesce.GetCounters();
+		assert(counters.Coalesced == 2 && counters.Dropped == 1 && "Coalesce should merge before dropping");
+		assert(coalesce.TryPop() == 12 && coalesce.TryPop() == 3 && "Merged item should keep its place");
+
+		// A blocked producer resumes once the consumer makes room
+		Elos::ThreadSafeQueue<int> block(1, Elos::QueueOverflowPolicy::Block);
+		block.Push(1);
+		std::atomic<bool> pushed{ false };
+		std::thread producer([&]()
+		{
+			block.Push(2);
+			pushed = true;
+		});
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		assert(!pushed && "Push into a full blocking queue should wait");
+		assert(block.WaitAndPop() == 1 && block.WaitAndPop() == 2 && "Blocked push should land after the pop");
+		producer.join();
+		assert(block.GetCounters().Dropped == 0 && block.GetCounters().HighWater == 1 && "Block should never drop");
+
+		std::println("Bounded ThreadSafeQueue policies passed!");
+	};
+
+	const auto TestQueueWaiting = []()
+	{
+		std::println("Testing ThreadSafeQueue waiting and Close");
+
+		Elos::ThreadSafeQueue<int> queue;
+		queue.SetWaitStrategy(Elos::QueueWaitStrategy::LowLatency());
+
+		const auto start = std::chrono::steady_clock::now();
+		assert(!queue.WaitAndPopFor(std::chrono::milliseconds(20)) && "Timed wait on an empty queue should time out");
+		assert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20) && "Timed wait should last until the timeout");
+
+		queue.Push(1);
+		assert(queue.WaitAndPopUntil(std::chrono::steady_clock::now() + std::chrono::seconds(5)) == 1 && "Timed wait should return a queued item");
+
+		// Spinning, timed and parked consumers all wake for pushes and for Close
+		std::atomic<int> received{ 0 };
+		std::atomic<int> closedSeen{ 0 };
+		std::vector<std::thread> consumers;
+		for (int i = 0; i < 4; ++i)
+		{
+			consumers.emplace_back([&, i]()
+			{
+				for (;;)
+				{
+					if (i % 2 == 0)
+					{
+						try
+						{
+							(void)queue.WaitAndPop();
+							++received;
+						}
+						catch (const Elos::QueueClosedError&)
+						{
+							++closedSeen;
+							return;
+						}
+					}
+					else if (queue.WaitAndPopFor(std::chrono::seconds(5)))
+					{
+						++received;
+					}
+					else
+					{
+						++closedSeen;
+						return;
+					}
+				}
+			});
+		}
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			queue.Push(i);
+		}
+		while (received != 1000)
+		{
+			std::this_thread::yield();
+		}
+		queue.Close();
+		for (auto& consumer : consumers)
+		{
+			consumer.join();
+		}
+
+		assert(closedSeen == 4 && "Close should wake every waiter");
+		queue.Push(5);
+		assert(queue.Empty() && queue.GetCounters().Dropped == 1 && "Pushes after Close should be dropped");
+
+		bool threw = false;
+		try
+		{
+			(void)queue.WaitAndPop();
+		}
+		catch (const Elos::QueueClosedError&)
+		{
+			threw = true;
+		}
+		assert(threw && "WaitAndPop on a closed, drained queue should throw");
+
+		std::println("ThreadSafeQueue waiting and Close passed!");
+	};
+
+	const auto TestQueueTelemetry = []()
+	{
+		std::println("Testing queue telemetry");
+
+		Elos::ThreadSafeQueue<int> queue;
+		assert(!queue.GetTelemetry() && "Telemetry should be off by default");
+		queue.Push(0);
+
+		Elos::QueueTelemetry& telemetry = queue.EnableTelemetry();
+		int snapshots = 0;
+		Elos::u64 lastDepth = 0;
+		telemetry.SetSnapshotCallback(std::chrono::milliseconds(50), [&](const Elos::QueueStats& stats)
+		{
+			++snapshots;
+			lastDepth = stats.Depth;
+		});
+
+		queue.PushRange(std::vector<int>{ 1, 2 });
+		std::this_thread::sleep_for(std::chrono::milliseconds(60));
+		assert(queue.TryPop() == 0 && "Items queued before enabling should still pop");
+		std::vector<int> drained;
+		queue.SwapOut(drained);
+
+		const Elos::QueueStats stats = telemetry.GetStats();
+		assert(stats.Pushed == 2 && stats.Popped == 3 && stats.Depth == 0 && stats.HighWater == 3 && "Counts and depth should track the queue");
+		assert(stats.MaxLatencyMs >= 60.0 && stats.LatencyPercentileNs(0.5) >= 60'000'000 && "Latency should cover the time spent queued");
+		assert(snapshots == 1 && lastDepth == 2 && "Snapshot should fire once the interval has elapsed");
+
+		Elos::ThreadSafePriorityQueue<int> priority;
+		Elos::QueueTelemetry& priorityTelemetry = priority.EnableTelemetry();
+		priority.Push(1);
+		priority.Push(2);
+		assert(priority.WaitAndPop() == 2 && priorityTelemetry.GetStats().Popped == 1 && priorityTelemetry.GetStats().Depth == 1 && "Priority queue should report telemetry too");
+
+		std::println("Queue telemetry passed!");
+	};
+
+	const auto TestQueueSet = []()
+	{
+		std::println("Testing QueueSet");
+
+		Elos::ThreadSafeQueue<int> numbers;
+		Elos::ThreadSafeQueue<std::unique_ptr<int>> pointers;
+		Elos::QueueSet set;
+		const size_t numbersIndex  = set.Add(numbers);
+		const size_t pointersIndex = set.Add(pointers);
+
+		assert(!set.Poll() && "Poll on empty queues should find nothing");
+		assert(!set.WaitAnyFor(std::chrono::milliseconds(10)) && "WaitAnyFor should time out when nothing arrives");
+
+		// Both queues have items: scans rotate so neither is starved
+		numbers.Push(1);
+		pointers.Push(std::make_unique<int>(2));
+		const size_t first  = set.WaitAny();
+		const size_t second = set.WaitAny();
+		assert(first != second && "Consecutive waits should report different non-empty queues");
+		numbers.Clear();
+		pointers.Clear();
+
+		// A blocked consumer wakes for a push to any queue and learns which one
+		std::thread producer([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			pointers.Push(std::make_unique<int>(3));
+		});
+		const std::optional<size_t> woken = set.WaitAnyFor(std::chrono::seconds(5));
+		assert(woken == pointersIndex && *pointers.WaitAndPop() == 3 && "WaitAny should report the queue that was pushed to");
+		producer.join();
+
+		// Many producers, one consumer servicing every queue
+		constexpr int perQueue = 10'000;
+		std::thread numberProducer([&]()
+		{
+			for (int i = 0; i < perQueue; ++i)
+			{
+				numbers.Push(i);
+			}
+		});
+		std::thread pointerProducer([&]()
+		{
+			for (int i = 0; i < perQueue; ++i)
+			{
+				pointers.Push(std::make_unique<int>(i));
+			}
+		});
+		int received = 0;
+		while (received < 2 * perQueue)
+		{
+			const size_t index = set.WaitAny();
+			const bool popped = index == numbersIndex ? numbers.TryPop().has_value() : pointers.TryPop().has_value();
+			received += popped;
+		}
+		numberProducer.join();
+		pointerProducer.join();
+		assert(numbers.Empty() && pointers.Empty() && "Every item should be seen through WaitAny");
+
+		// Closing the queues releases a consumer blocked in WaitAny. Items queued before Close still come out
+		numbers.Push(7);
+		numbers.Close();
+		assert(set.WaitAny() == numbersIndex && numbers.TryPop() == 7 && "Items queued before Close should still be reported");
+		std::thread closer([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			pointers.Close();
+		});
+		bool released = false;
+		try
+		{
+			(void)set.WaitAny();
+		}
+		catch (const Elos::QueueClosedError&)
+		{
+			released = true;
+		}
+		closer.join();
+		assert(released && "WaitAny should throw once every queue is closed and drained");
+
+		released = false;
+		try
+		{
+			(void)set.WaitAnyFor(std::chrono::seconds(5));
+		}
+		catch (const Elos::QueueClosedError&)
+		{
+			released = true;
+		}
+		assert(released && "WaitAnyFor should throw as well rather than wait out its timeout");
+
+		std::println("QueueSet passed!");
+	};
+
+	const auto TestQueueSetTeardown = []()
+	{
+		std::println("Testing QueueSet teardown after close");
+
+		// The consumer destroys its set the moment the close releases it, racing the closing producer
+		for (int round = 0; round < 500; ++round)
+		{
+			Elos::ThreadSafeQueue<int> queue;
+			auto* set = new Elos::QueueSet;
+			(void)set->Add(queue);
+
+			std::thread consumer([&queue, set]()
+			{
+				try
+				{
+					for (;;)
+					{
+						(void)set->WaitAny();
+						(void)queue.TryPop();
+					}
+				}
+				catch (const Elos::QueueClosedError&)
+				{
+				}
+				delete set;
+			});
+
+			queue.Push(round);
+			queue.Close();
+			consumer.join();
+		}
+
+		std::println("QueueSet teardown after close passed!");
+	};
+
+	const auto TestHeaps = []()
+	{
+		std::println("Testing binary and pairing heaps");
+
+		Elos::BinaryHeap<int> binary;
+		Elos::PairingHeap<int> pairing;
+		std::mt19937 random(7);
+		std::vector<int> reference;
+		for (int round = 0; round < 2000; ++round)
+		{
+			// Interleave pushes and pops so the pairing heap recycles nodes
+			if (reference.empty() || random() % 3 != 0)
+			{
+				const int value = static_cast<int>(random() % 500);
+				binary.Push(int(value));
+				pairing.Push(int(value));
+				reference.push_back(value);
+				std::push_heap(reference.begin(), reference.end());
+				continue;
+			}
+
+			std::pop_heap(reference.begin(), reference.end());
+			const int expected = reference.back();
+			reference.pop_back();
+			assert(binary.Pop() == expected && pairing.Pop() == expected && "Heaps should pop the largest item");
+		}
+		assert(binary.Size() == reference.size() && pairing.Size() == reference.size() && "Heap sizes should match");
+
+		std::println("Binary and pairing heaps passed!");
+	};
+
+	const auto TestPriorityQueue = []()
+	{
+		std::println("Testing ThreadSafePriorityQueue");
+
+		struct Job
+		{
+			int Priority;
+			int Id;
+		};
+		const auto byPriority = [](const Job& a, const Job& b) { return a.Priority < b.Priority; };
+
+		Elos::ThreadSafePriorityQueue<Job, decltype(byPriority), Elos::PairingHeap> queue(byPriority);
+		queue.Push(Job{ 0, 1 });
+		queue.Push(Job{ 1, 2 });
+		queue.Push(Job{ 0, 3 });
+		queue.Push(Job{ 2, 4 });
+		queue.Push(Job{ 1, 5 });
+
+		std::vector<int> order;
+		while (const std::optional<Job> job = queue.TryPop())
+		{
+			order.push_back(job->Id);
+		}
+		assert((order == std::vector<int>{ 4, 2, 5, 1, 3 }) && "Higher priority first, push order within a priority");
+
+		queue.Push(Job{ 0, 6 });
+		queue.Push(Job{ 1, 7 });
+		std::vector<Job> drained;
+		assert(queue.DrainTo(std::back_inserter(drained)) == 2 && queue.Empty() && "DrainTo should take every item");
+		assert(drained[0].Id == 7 && drained[1].Id == 6 && "DrainTo should keep priority order");
+
+		queue.PushRange(std::vector<Job>{ { 0, 8 }, { 1, 9 }, { 0, 10 } });
+		assert(queue.Size() == 3 && queue.TryPop()->Id == 9 && "PushRange should insert every item by priority");
+		assert(queue.TryPop()->Id == 8 && queue.TryPop()->Id == 10 && "PushRange should keep order among equals");
+
+		assert(!queue.WaitAndPopFor(std::chrono::milliseconds(10)) && "Timed wait on an empty queue should time out");
+		std::thread closer([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			queue.Close();
+		});
+		bool threw = false;
+		try
+		{
+			(void)queue.WaitAndPop();
+		}
+		catch (const Elos::QueueClosedError&)
+		{
+			threw = true;
+		}
+		closer.join();
+		assert(threw && "Close should wake a blocked WaitAndPop");
+
+		std::println("ThreadSafePriorityQueue passed!");
+	};
+
+	const auto TestDeadlineQueue = []()
+	{
+		std::println("Testing ThreadSafeDeadlineQueue");
+
+		using Clock = std::chrono::steady_clock;
+		Elos::ThreadSafeDeadlineQueue<int> queue;
+		const auto start = Clock::now();
+		queue.PushAfter(std::chrono::milliseconds(40), 3);
+		queue.PushAfter(std::chrono::milliseconds(20), 2);
+		queue.Push(start, 1);
+
+		assert(queue.TryPop() == 1 && "Item already due should pop immediately");
+		assert(!queue.TryPop() && "Items before their deadline should stay queued");
+
+		// A consumer sleeping until 20ms is re-armed by an earlier push from another thread
+		std::thread producer([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			queue.Push(Clock::now(), 0);
+		});
+		assert(queue.WaitAndPop() == 0 && "Earlier deadline pushed while waiting should come first");
+		producer.join();
+		assert(queue.WaitAndPop() == 2 && Clock::now() - start >= std::chrono::milliseconds(20) && "WaitAndPop should sleep until the deadline");
+		assert(queue.WaitAndPop() == 3 && Clock::now() - start >= std::chrono::milliseconds(40) && "Deadlines should come out in order");
+
+		queue.PushAfter(std::chrono::hours(1), 4);
+		queue.Close();
+		bool threw = false;
+		try
+		{
+			(void)queue.WaitAndPop();
+		}
+		catch (const Elos::QueueClosedError&)
+		{
+			threw = true;
+		}
+		assert(threw && queue.Size() == 1 && "Close should end the wait without delivering pending items");
+
+		// Two idle consumers: the one woken for a later item can pop an earlier one instead, and must
+		// pass the wake on so the other re-arms on the item left behind
+		Elos::ThreadSafeDeadlineQueue<int> shared;
+		std::atomic<int> popped{ 0 };
+		std::vector<std::thread> consumers;
+		for (int c = 0; c < 2; ++c)
+		{
+			consumers.emplace_back([&]()
+			{
+				(void)shared.WaitAndPop();
+				++popped;
+			});
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		shared.PushAfter(std::chrono::milliseconds(10), 1);
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		shared.Push(Clock::now(), 2);
+
+		const auto deadline = Clock::now() + std::chrono::seconds(2);
+		while (popped.load() < 2 && Clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		assert(popped.load() == 2 && "The deferred item should still be popped by the other consumer");
+		for (std::thread& consumer : consumers)
+		{
+			consumer.join();
+		}
+
+		std::println("ThreadSafeDeadlineQueue passed!");
+	};
+
+	const auto TestDeadlineQueueEarlierPushes = []()
+	{
+		std::println("Testing ThreadSafeDeadlineQueue earlier pushes under a waiter");
+
+		// Each push is earlier than the top the waiter sleeps on, so the heap's storage is moved or
+		// its root replaced while the waiter is parked on the old top's deadline
+		const auto run = [](auto& queue)
+		{
+			using Clock = std::chrono::steady_clock;
+			const auto start = Clock::now();
+			queue.Push(start + std::chrono::hours(2), -1);
+
+			std::atomic<int> popped{ 0 };
+			std::thread waiter([&]()
+			{
+				try
+				{
+					for (;;)
+					{
+						(void)queue.WaitAndPop();
+						++popped;
+					}
+				}
+				catch (const Elos::QueueClosedError&)
+				{
+				}
+			});
+
+			for (int i = 0; i < 2000; ++i)
+			{
+				queue.Push(start + std::chrono::hours(1) - std::chrono::milliseconds(i), i);
+				if (i % 64 == 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+			queue.Close();
+			waiter.join();
+			assert(popped.load() == 0 && queue.Size() == 2001 && "Nothing should be due yet");
+		};
+
+		Elos::ThreadSafeDeadlineQueue<int> binary;
+		run(binary);
+		Elos::ThreadSafeDeadlineQueue<int, std::chrono::steady_clock, Elos::PairingHeap> pairing;
+		run(pairing);
+
+		std::println("ThreadSafeDeadlineQueue earlier pushes passed!");
+	};
+
+	const auto TestSpscBasics = []()
+	{
+		std::println("Testing SPSC ring buffer basics");
+
+		Elos::SpscRingBuffer<int, 4> ring;
+		assert(ring.Empty() && !ring.TryPop() && "New ring should be empty");
+
+		for (int i = 0; i < 4; ++i)
+		{
+			assert(ring.TryPush(i) && "Push should succeed until full");
+		}
+		assert(!ring.TryPush(4) && ring.Size() == 4 && "Push into a full ring should fail");
+
+		// Wrap around the end of the slot array a few times
+		for (int i = 4; i < 20; ++i)
+		{
+			const std::optional<int> front = ring.TryPop();
+			assert(front && *front == i - 4 && "Items should come out in FIFO order");
+			assert(ring.TryPush(i) && "Freed slot should be reusable");
+		}
+
+		std::array<int, 8> out{};
+		assert(ring.TryPopBatch(out) == 4 && "Batch pop should take everything available");
+		assert(out[0] == 16 && out[3] == 19 && ring.Empty() && "Batch pop should keep order");
+
+		const std::array<int, 6> in{ 1, 2, 3, 4, 5, 6 };
+		assert(ring.TryPushBatch(std::span(in)) == 4 && "Batch push should stop when full");
+		assert(ring.TryPopBatch(std::span(out).first(2)) == 2 && out[1] == 2 && "Partial batch pop should respect the span size");
+
+		std::println("SPSC ring buffer basics passed!");
+	};
+
+	const auto TestSpscOwnership = []()
+	{
+		std::println("Testing SPSC ring buffer with move-only items");
+
+		auto tracked = std::make_shared<int>(7);
+		{
+			Elos::SpscRingBuffer<std::unique_ptr<std::shared_ptr<int>>, 8> ring;
+			assert(ring.TryEmplace(std::make_unique<std::shared_ptr<int>>(tracked)) && "Emplace should succeed");
+			assert(ring.TryPush(std::make_unique<std::shared_ptr<int>>(tracked)) && "Move push should succeed");
+
+			std::unique_ptr<std::shared_ptr<int>> item;
+			assert(ring.TryPop(item) && **item == 7 && "Popped item should be moved out");
+			item.reset();
+			assert(tracked.use_count() == 2 && "Only the queued item should still hold a reference");
+		}
+		assert(tracked.use_count() == 1 && "Items left in the ring should be destroyed with it");
+
+		std::println("SPSC ring buffer move-only items passed!");
+	};
+
+	const auto TestSpscThreads = []()
+	{
+		std::println("Testing SPSC ring buffer across threads");
+
+		constexpr Elos::u64 count = 1'000'000;
+		auto ring = std::make_unique<Elos::SpscRingBuffer<Elos::u64, 1024>>();
+
+		// Both sides yield when stuck so the test also runs quickly on a single core
+		std::thread producer([&]()
+		{
+			std::array<Elos::u64, 32> batch{};
+			Elos::u64 next = 0;
+			while (next < count)
+			{
+				// Alternate single and batched pushes
+				if (next % 2 == 0)
+				{
+					if (ring->TryPush(next))
+					{
+						++next;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+					continue;
+				}
+
+				const Elos::u64 size = std::min<Elos::u64>(batch.size(), count - next);
+				for (Elos::u64 i = 0; i < size; ++i)
+				{
+					batch[i] = next + i;
+				}
+				const Elos::u64 pushed = ring->TryPushBatch(std::span(batch).first(size));
+				if (pushed == 0)
+				{
+					std::this_thread::yield();
+				}
+				next += pushed;
+			}
+		});
+
+		bool ordered = true;
+		Elos::u64 expected = 0;
+		std::array<Elos::u64, 64> out{};
+		while (expected < count)
+		{
+			const Elos::u64 popped = ring->TryPopBatch(out);
+			if (popped == 0)
+			{
+				std::this_thread::yield();
+			}
+			for (Elos::u64 i = 0; i < popped; ++i)
+			{
+				ordered = ordered && out[i] == expected++;
+			}
+		}
+		producer.join();
+
+		assert(ordered && "Every item should arrive exactly once and in order");
+		assert(ring->Empty() && "Ring should be drained");
+
+		std::println("SPSC ring buffer across threads passed!");
+	};
+
+	const auto TestMpmcBasics = []()
+	{
+		std::println("Testing MPMC queue basics");
+
+		Elos::MpmcQueue<std::unique_ptr<int>, 4> queue;
+		assert(queue.Empty() && !queue.TryPop() && "New queue should be empty");
+
+		for (int i = 0; i < 4; ++i)
+		{
+			assert(queue.TryPush(std::make_unique<int>(i)) && "Push should succeed until full");
+		}
+		assert(!queue.TryPush(std::make_unique<int>(4)) && queue.Size() == 4 && "Push into a full queue should fail");
+
+		for (int i = 4; i < 20; ++i)
+		{
+			assert(*queue.WaitAndPop() == i - 4 && "Items should come out in FIFO order");
+			queue.Emplace(new int(i));
+		}
+
+		queue.Clear();
+		assert(queue.Empty() && "Clear should drop every item");
+
+		std::println("MPMC queue basics passed!");
+	};
+
+	const auto TestMpmcThreads = []()
+	{
+		std::println("Testing MPMC queue across threads");
+
+		constexpr int producers = 4;
+		constexpr int consumers = 4;
+		constexpr Elos::u64 perProducer = 100'000;
+
+		// Small capacity so producers regularly block on a full queue
+		Elos::MpmcQueue<Elos::u64, 64> queue;
+		std::atomic<Elos::u64> sum{ 0 };
+		std::atomic<Elos::u64> received{ 0 };
+
+		std::vector<std::thread> threads;
+		for (int p = 0; p < producers; ++p)
+		{
+			threads.emplace_back([&, p]()
+			{
+				for (Elos::u64 i = 0; i < perProducer; ++i)
+				{
+					queue.Push(p * perProducer + i);
+				}
+			});
+		}
+
+		constexpr Elos::u64 total = producers * perProducer;
+		for (int c = 0; c < consumers; ++c)
+		{
+			threads.emplace_back([&]()
+			{
+				// Each consumer takes its share with blocking pops
+				for (Elos::u64 i = 0; i < total / consumers; ++i)
+				{
+					sum += queue.WaitAndPop();
+					++received;
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		assert(received == total && queue.Empty() && "Every item should be popped exactly once");
+		assert(sum == total * (total - 1) / 2 && "No item should be lost or duplicated");
+
+		// A parked consumer wakes up for a late push
+		std::thread late([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			queue.Push(42);
+		});
+		assert(queue.WaitAndPop() == 42 && "Parked consumer should be woken by a push");
+		late.join();
+
+		std::println("MPMC queue across threads passed!");
+	};
+
+	const auto TestMpmcParking = []()
+	{
+		std::println("Testing MPMC queue parking with a polling consumer");
+
+		// Blocking consumers race a consumer that only polls, so parked consumers regularly lose the
+		// item they were woken for and must park again. A lost wakeup leaves one asleep at the end
+		constexpr int blocking = 3;
+		constexpr Elos::u64 rounds = 300;
+		constexpr Elos::u64 perRound = 64;
+		constexpr Elos::u64 stop = ~Elos::u64{ 0 };
+
+		for (Elos::u64 round = 0; round < rounds; ++round)
+		{
+			Elos::MpmcQueue<Elos::u64, 16> queue;
+			std::atomic<Elos::u64> received{ 0 };
+			std::atomic<int> finished{ 0 };
+
+			std::vector<std::thread> threads;
+			for (int c = 0; c < blocking; ++c)
+			{
+				threads.emplace_back([&]()
+				{
+					while (queue.WaitAndPop() != stop)
+					{
+						++received;
+					}
+					++finished;
+				});
+			}
+			std::thread polling([&]()
+			{
+				while (received.load() < perRound)
+				{
+					if (queue.TryPop())
+					{
+						++received;
+					}
+				}
+			});
+
+			for (Elos::u64 i = 0; i < perRound; ++i)
+			{
+				queue.Push(i);
+				if (i % 8 == 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+			// The polling consumer is gone before the stop items go in, so only blocking consumers take them
+			polling.join();
+
+			for (int c = 0; c < blocking; ++c)
+			{
+				queue.Push(stop);
+			}
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (finished.load() < blocking && std::chrono::steady_clock::now() < deadline)
+			{
+				std::this_thread::yield();
+			}
+			assert(finished.load() == blocking && "Every parked consumer should wake for the items pushed after it parked");
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		std::println("MPMC queue parking with a polling consumer passed!");
+	};
+
+	const auto TestSeqLock = []()
+	{
+		std::println("Testing SeqLock");
+
+		// Every field derives from the first, so a torn read shows up as a mismatch
+		struct Snapshot
+		{
+			Elos::u64 Value  = 0;
+			Elos::u64 Double = 0;
+			Elos::u32 Low    = 0;
+			bool      Odd    = false;
+		};
+
+		Elos::SeqLock<Snapshot> lock;
+		assert(lock.Load().Value == 0 && lock.GetVersion() == 0 && "A new SeqLock should hold a default value");
+		lock.Update([](Snapshot& snapshot) { snapshot.Value = 1; });
+		assert(lock.Load().Value == 1 && lock.GetVersion() == 1 && "Update should publish a new version");
+
+		constexpr Elos::u64 writes = 200'000;
+		std::atomic<bool> done{ false };
+		std::atomic<bool> torn{ false };
+		std::vector<std::thread> readers;
+		for (int r = 0; r < 3; ++r)
+		{
+			readers.emplace_back([&]()
+			{
+				Elos::u64 last = 0;
+				while (!done.load(std::memory_order_acquire))
+				{
+					const Snapshot snapshot = lock.Load();
+					if (snapshot.Double != snapshot.Value * 2 || snapshot.Low != static_cast<Elos::u32>(snapshot.Value)
+						|| snapshot.Odd != ((snapshot.Value & 1) != 0) || snapshot.Value < last)
+					{
+						torn.store(true);
+					}
+					last = snapshot.Value;
+				}
+			});
+		}
+
+		for (Elos::u64 i = 2; i <= writes; ++i)
+		{
+			lock.Store(Snapshot{ i, i * 2, static_cast<Elos::u32>(i), (i & 1) != 0 });
+		}
+		done.store(true, std::memory_order_release);
+		for (std::thread& reader : readers)
+		{
+			reader.join();
+		}
+
+		assert(!torn.load() && "Readers must only ever see whole, in-order writes");
+		assert(lock.Load().Value == writes && lock.GetVersion() == writes && "The last write should win");
+
+		std::println("SeqLock passed!");
+	};
+
+	TestThreadSafeQueue();
+	TestBoundedQueue();
+	TestQueueWaiting();
+	TestQueueTelemetry();
+	TestQueueSet();
+	TestQueueSetTeardown();
+	TestHeaps();
+	TestPriorityQueue();
+	TestDeadlineQueue();
+	TestDeadlineQueueEarlierPushes();
+	TestSpscBasics();
+	TestSpscOwnership();
+	TestSpscThreads();
+	TestMpmcBasics();
+	TestMpmcThreads();
+	TestMpmcParking();
+	TestSeqLock();
+
+	return 0;
+}
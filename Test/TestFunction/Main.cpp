@@ -0,0 +1,176 @@
+#include <Elos/Common/InplaceFunction.h>
+#include <Elos/Common/FunctionRef.h>
+#include <Elos/Event/Signal.h>
+#include <Elos/Utils/Timer.h>
+#include <print>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace
+{
+	Elos::u64 g_allocations = 0;
+
+	// Allocations made while running body
+	template <typename Body>
+	Elos::u64 CountAllocations(Body&& body)
+	{
+		const Elos::u64 before = g_allocations;
+		body();
+		return g_allocations - before;
+	}
+
+	int Twice(int v)
+	{
+		return v * 2;
+	}
+}
+
+void* operator new(std::size_t size)
+{
+	++g_allocations;
+	if (void* memory = std::malloc(size ? size : 1))
+	{
+		return memory;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+int main()
+{
+	const auto TestInplaceFunction = []()
+	{
+		std::println("Testing inplace function");
+
+		Elos::InplaceFunction<int(int)> empty;
+		assert(!empty && empty == nullptr && "Default constructed function should be empty");
+
+		Elos::InplaceFunction<int(int)> fromPointer = &Twice;
+		assert(fromPointer(4) == 8 && "Function pointers should be callable");
+
+		int calls = 0;
+		Elos::InplaceFunction<int(int)> counter = [&calls, offset = 1](int v) mutable { ++calls; return v + offset++; };
+		assert(counter(1) == 2 && counter(1) == 3 && calls == 2 && "Mutable state should persist between calls");
+
+		// Copies own independent state, moves leave the source empty
+		Elos::InplaceFunction<int(int)> copy = counter;
+		assert(copy(0) == 3 && counter(0) == 3 && "Copies should not share state");
+
+		Elos::InplaceFunction<int(int)> moved = std::move(copy);
+		assert(!copy && moved && "Moved-from function should be empty");
+
+		// Captured resources are released with the function
+		auto resource = std::make_shared<int>(5);
+		{
+			Elos::InplaceFunction<int(int)> holder = [resource](int v) { return v + *resource; };
+			assert(resource.use_count() == 2 && holder(1) == 6 && "Capture should be held");
+			holder = nullptr;
+			assert(resource.use_count() == 1 && "Reset should destroy the capture");
+		}
+
+		// A smaller function converts into a larger one
+		Elos::InplaceFunction<int(int), 16> small = [](int v) { return -v; };
+		Elos::InplaceFunction<int(int), 64> large = small;
+		assert(large(3) == -3 && "Converted function should call the same callable");
+
+		std::println("Inplace function passed!");
+	};
+
+	const auto TestNoAllocations = []()
+	{
+		std::println("Testing that inplace functions never allocate");
+
+		auto resource = std::make_shared<int>(1);
+		const Elos::u64 allocations = CountAllocations([&]()
+		{
+			Elos::InplaceFunction<int(int), 48> function = [resource, a = 1.0, b = 2.0, c = 3.0](int v) { return v + *resource + static_cast<int>(a + b + c); };
+			Elos::InplaceFunction<int(int), 48> copy = function;
+			Elos::InplaceFunction<int(int), 48> moved = std::move(function);
+			copy = moved;
+			for (int i = 0; i < 100; ++i)
+			{
+				(void)copy(i);
+			}
+		});
+		assert(allocations == 0 && "Inplace function should not allocate");
+
+		// Same capture through std::function allocates
+		const Elos::u64 standardAllocations = CountAllocations([&]()
+		{
+			std::function<int(int)> function = [resource, a = 1.0, b = 2.0, c = 3.0](int v) { return v + *resource + static_cast<int>(a + b + c); };
+			std::function<int(int)> copy = function;
+			(void)copy(1);
+		});
+		std::println("std::function allocations for the same capture: {}", standardAllocations);
+
+		// Emission does not allocate and connecting only grows the slot arrays
+		Elos::Signal<int> signal;
+		int sum = 0;
+		std::vector<Elos::Connection<int>> connections;
+		connections.reserve(16);
+		for (int i = 0; i < 16; ++i)
+		{
+			connections.push_back(signal.Connect([&sum, i, resource](int v) { sum += v + i + *resource; }));
+		}
+
+		assert(CountAllocations([&]() { signal.Emit(1); }) == 0 && "Emit should not allocate");
+
+		// Disconnect/reconnect reuses slot map entries and dense storage
+		connections.front().Disconnect();
+		connections.front() = signal.Connect([&sum](int v) { sum += v; });
+		const Elos::u64 churn = CountAllocations([&]()
+		{
+			connections.front().Disconnect();
+			connections.front() = signal.Connect([&sum](int v) { sum -= v; });
+		});
+		assert(churn == 0 && "Reconnecting into reused storage should not allocate");
+
+		std::println("No allocations passed!");
+	};
+
+	const auto TestFunctionRef = []()
+	{
+		std::println("Testing function ref");
+
+		int total = 0;
+		auto accumulate = [&total](int v) { total += v; return total; };
+
+		const auto CallThrice = [](Elos::FunctionRef<int(int)> callback)
+		{
+			callback(1);
+			callback(2);
+			return callback(3);
+		};
+
+		assert(CallThrice(accumulate) == 6 && "Reference should call the referenced lambda");
+		assert(CallThrice(Twice) == 6 && "Reference should accept plain functions");
+
+		// Timer::Tick takes its callback by reference
+		Elos::Timer timer;
+		Elos::u64 ticks = 0;
+		assert(CountAllocations([&]() { timer.Tick([&ticks](const Elos::Timer::TimeInfo&) { ++ticks; }); }) == 0
+			&& "Ticking should not allocate");
+		assert(ticks == 1 && "Tick should call the callback once");
+
+		std::println("Function ref passed!");
+	};
+
+	TestInplaceFunction();
+	TestNoAllocations();
+	TestFunctionRef();
+
+	return 0;
+}
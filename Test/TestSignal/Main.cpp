@@ -0,0 +1,510 @@
+#include <Elos/Event/Signal.h>
+#include <Elos/Event/ConcurrentSignal.h>
+#include <Elos/Event/StaticSignal.h>
+#include <print>
+#include <span>
+#include <stdexcept>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	int g_freeSlotSum = 0;
+
+	void FreeSlot(int v)
+	{
+		g_freeSlotSum += v;
+	}
+
+	struct Subsystem
+	{
+		int Sum = 0;
+		void OnValue(int v) { Sum += v; }
+		int Peek(int) const { return Sum; }
+	};
+}
+
+int main()
+{
+	const auto TestConnectAndEmit = []()
+	{
+		std::println("Testing connect and emit");
+
+		Elos::Signal<int> signal;
+		int sum = 0;
+
+		auto c1 = signal.Connect([&sum](int v) { sum += v; });
+		auto c2 = signal.Connect([&sum](int v) { sum += v * 10; });
+		assert(signal.ConnectionCount() == 2 && "Should have two connections");
+		assert(c1.IsConnected() && c2.IsConnected() && "Both connections should be live");
+		assert(c1.Id() != c2.Id() && "Connection ids should be unique");
+
+		signal.Emit(1);
+		assert(sum == 11 && "Both slots should be called");
+
+		signal(2);
+		assert(sum == 33 && "Call operator should emit");
+
+		std::println("Connect and emit passed!");
+	};
+
+	const auto TestEmissionOrder = []()
+	{
+		std::println("Testing emission order survives compaction");
+
+		Elos::Signal<> signal;
+		std::vector<int> order;
+		std::vector<Elos::Connection<>> connections;
+
+		for (int i = 0; i < 8; ++i)
+		{
+			connections.push_back(signal.Connect([&order, i]() { order.push_back(i); }));
+		}
+
+		// Enough disconnects to trigger compaction
+		for (int i = 0; i < 8; i += 2)
+		{
+			connections[i].Disconnect();
+		}
+		assert(signal.ConnectionCount() == 4 && "Half of the slots should remain");
+
+		signal.Emit();
+		assert((order == std::vector<int>{ 1, 3, 5, 7 }) && "Remaining slots should keep connection order");
+
+		// Ids of survivors must still resolve after compaction
+		for (int i = 1; i < 8; i += 2)
+		{
+			assert(connections[i].IsConnected() && "Surviving connection should still be connected");
+		}
+
+		std::println("Emission order passed!");
+	};
+
+	const auto TestStaleHandles = []()
+	{
+		std::println("Testing generation-checked handles");
+
+		Elos::Signal<int> signal;
+		auto first = signal.Connect([](int) {});
+		const auto staleId = first.Id();
+
+		assert(first.Disconnect() && "First disconnect should succeed");
+		assert(!first.Disconnect() && "Second disconnect should fail");
+		assert(!signal.Disconnect(staleId) && "Stale id should be rejected");
+
+		// The slot map index is reused but the generation differs
+		auto second = signal.Connect([](int) {});
+		assert(second.Id() != staleId && "Reused index should get a new generation");
+		assert(!signal.IsConnected(staleId) && "Stale id must not alias the new slot");
+		assert(signal.IsConnected(second.Id()) && "New id should be connected");
+
+		std::println("Generation-checked handles passed!");
+	};
+
+	const auto TestDisconnectDuringEmit = []()
+	{
+		std::println("Testing disconnect during emit");
+
+		Elos::Signal<> signal;
+		int selfCalls  = 0;
+		int otherCalls = 0;
+
+		Elos::Connection<> self;
+		Elos::Connection<> other;
+
+		self = signal.Connect([&]()
+		{
+			++selfCalls;
+			self.Disconnect();
+			other.Disconnect();
+		});
+		other = signal.Connect([&]() { ++otherCalls; });
+
+		signal.Emit();
+		assert(selfCalls == 1 && "Self-disconnecting slot should run once");
+		assert(otherCalls == 0 && "Slot disconnected earlier in the emission should be skipped");
+		assert(!signal.HasConnections() && "All slots should be disconnected");
+
+		signal.Emit();
+		assert(selfCalls == 1 && "Disconnected slot should not run again");
+
+		std::println("Disconnect during emit passed!");
+	};
+
+	const auto TestConnectDuringEmit = []()
+	{
+		std::println("Testing connect during emit");
+
+		Elos::Signal<> signal;
+		int lateCalls = 0;
+		std::vector<Elos::Connection<>> connections;
+
+		connections.push_back(signal.Connect([&]()
+		{
+			// Force the dense array to grow while this slot is running
+			for (int i = 0; i < 64; ++i)
+			{
+				connections.push_back(signal.Connect([&]() { ++lateCalls; }));
+			}
+		}));
+
+		signal.Emit();
+		assert(lateCalls == 0 && "Slots connected during an emission should not run in it");
+		assert(signal.ConnectionCount() == 65 && "Late connections should be kept");
+
+		connections.front().Disconnect();
+		signal.Emit();
+		assert(lateCalls == 64 && "Late connections should run on the next emission");
+
+		std::println("Connect during emit passed!");
+	};
+
+	const auto TestLifetime = []()
+	{
+		std::println("Testing connection and signal lifetime");
+
+		Elos::Connection<int> connection;
+		{
+			Elos::Signal<int> signal;
+			connection = signal.Connect([](int) {});
+
+			Elos::Signal<int> moved = std::move(signal);
+			assert(connection.IsConnected() && "Connection should follow a moved signal");
+			assert(moved.ConnectionCount() == 1 && "Slots should move with the signal");
+		}
+		assert(!connection.IsConnected() && "Connection should notice the signal died");
+		assert(!connection.Disconnect() && "Disconnecting from a dead signal should fail");
+
+		Elos::Signal<int> signal;
+		int calls = 0;
+		{
+			Elos::ScopedConnection<int> scoped = signal.Connect([&calls](int) { ++calls; });
+			signal.Emit(0);
+		}
+		signal.Emit(0);
+		assert(calls == 1 && "Scoped connection should disconnect on destruction");
+
+		std::println("Lifetime passed!");
+	};
+
+	const auto TestConcurrentSignal = []()
+	{
+		std::println("Testing concurrent signal");
+
+		Elos::ConcurrentSignal<int> signal;
+		std::atomic<Elos::i64> sum{ 0 };
+
+		auto connection = signal.Connect([&sum](int v) { sum += v; });
+		const auto id = connection.Id();
+		signal.Emit(2);
+		assert(sum == 2 && "Slot should be called");
+		assert(connection.IsConnected() && signal.IsConnected(id) && "Connection should be live");
+		assert(connection.Disconnect() && "Disconnect should succeed");
+		assert(!connection.Disconnect() && "Second disconnect should fail");
+		assert(!signal.Disconnect(id) && "Disconnecting a dead id should fail");
+		signal.Emit(2);
+		assert(sum == 2 && "Disconnected slot should not be called");
+
+		// Disconnecting from inside a slot must not wait on the emission it runs in
+		Elos::ConcurrentConnection<int> self;
+		self = signal.Connect([&](int) { self.Disconnect(); });
+		signal.Emit(0);
+		assert(!signal.HasConnections() && !self.IsConnected() && "Self-disconnecting slot should be gone");
+
+		{
+			Elos::ScopedConcurrentConnection<int> scoped = signal.Connect([&sum](int v) { sum += v; });
+			signal.Emit(1);
+		}
+		signal.Emit(1);
+		assert(sum == 3 && "Scoped connection should disconnect on destruction");
+
+		Elos::ConcurrentConnection<int> outlived;
+		{
+			Elos::ConcurrentSignal<int> shortLived;
+			outlived = shortLived.Connect([](int) {});
+			assert(outlived.IsConnected() && "Connection should be live");
+		}
+		assert(!outlived.IsConnected() && !outlived.Disconnect() && "Connection should notice the signal died");
+
+		// Emitters race a mutator; the permanent slot must see every emission
+		std::atomic<Elos::i64> permanentCalls{ 0 };
+		auto permanent = signal.Connect([&permanentCalls](int) { ++permanentCalls; });
+
+		constexpr int emitters = 4;
+		constexpr int emitsPerThread = 20'000;
+		std::atomic<bool> done{ false };
+
+		std::thread mutator([&]()
+		{
+			while (!done.load())
+			{
+				auto transient = signal.Connect([&sum](int v) { sum += v; });
+				transient.Disconnect();
+			}
+		});
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < emitters; ++t)
+		{
+			threads.emplace_back([&]()
+			{
+				for (int i = 0; i < emitsPerThread; ++i)
+				{
+					signal.Emit(1);
+				}
+			});
+		}
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+		done = true;
+		mutator.join();
+
+		assert(permanentCalls == emitters * emitsPerThread && "Every emission should reach the permanent slot");
+		assert(signal.ConnectionCount() == 1 && "Only the permanent slot should remain");
+		assert(permanent.Disconnect() && "Permanent slot should disconnect");
+
+		std::println("Concurrent signal passed!");
+	};
+
+	const auto TestQueuedConnection = []()
+	{
+		std::println("Testing queued connections");
+
+		Elos::Signal<const std::vector<int>&> signal;
+		const auto mainThread = std::this_thread::get_id();
+		const auto mailbox = Elos::Mailbox::ForCurrentThread();
+
+		int sum = 0;
+		bool ranOnMainThread = true;
+		auto connection = signal.Connect([&](const std::vector<int>& values)
+		{
+			ranOnMainThread = ranOnMainThread && std::this_thread::get_id() == mainThread;
+			for (int v : values)
+			{
+				sum += v;
+			}
+		}, mailbox);
+
+		// Emitting on the owning thread calls straight through
+		signal.Emit({ 1 });
+		assert(sum == 1 && "Same-thread emission should run immediately");
+
+		std::thread([&]()
+		{
+			std::vector<int> values{ 1, 2, 3 };
+			signal.Emit(values);
+			values[0] = 100;  // The posted call must own a copy
+			signal.Emit(values);
+		}).join();
+
+		assert(sum == 1 && "Cross-thread emission should be deferred");
+		assert(mailbox->GetStats().Depth == 2 && "Both calls should be waiting");
+
+		assert(Elos::PumpMailbox() == 2 && "Pump should run both calls");
+		assert(sum == 1 + 6 + 105 && "Posted calls should see the emitted values");
+		assert(ranOnMainThread && "Posted calls should run on the mailbox thread");
+
+		// Calls still in the mailbox when the connection is cut are dropped
+		std::thread([&]() { signal.Emit({ 1000 }); }).join();
+		connection.Disconnect();
+		assert(Elos::PumpMailbox() == 0 && "Revoked call should not run");
+		assert(sum == 112 && "Revoked call should not run");
+
+		const Elos::MailboxStats stats = mailbox->GetStats();
+		assert(stats.Posted == 3 && stats.Executed == 2 && stats.Discarded == 1 && "Stats should count every message");
+		assert(stats.Depth == 0 && stats.PeakDepth == 2 && "Depth should be tracked");
+
+		std::println("Queued connections passed!");
+	};
+
+	const auto TestQueuedThrow = []()
+	{
+		std::println("Testing throwing queued slots");
+
+		Elos::Signal<int> signal;
+		const auto mailbox = Elos::Mailbox::ForCurrentThread();
+		const Elos::MailboxStats before = mailbox->GetStats();
+
+		std::vector<int> seen;
+		auto connection = signal.Connect([&seen](int v)
+		{
+			seen.push_back(v);
+			if (v == 2)
+			{
+				throw std::runtime_error("slot failed");
+			}
+		}, mailbox);
+
+		std::thread([&]()
+		{
+			signal.Emit(1);
+			signal.Emit(2);
+			signal.Emit(3);
+		}).join();
+
+		bool threw = false;
+		try
+		{
+			(void)Elos::PumpMailbox();
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw && "Slot exception should reach the pump caller");
+		assert(seen == std::vector<int>({ 1, 2 }) && "Messages after the throwing one should wait");
+
+		// The rest of the batch runs first on the next pump, each message exactly once
+		std::thread([&]() { signal.Emit(4); }).join();
+		assert(Elos::PumpMailbox() == 2 && "Next pump should finish the batch and the new message");
+		assert(seen == std::vector<int>({ 1, 2, 3, 4 }) && "Messages should keep their order");
+
+		// A throw from the last message must leave the mailbox ready for new posts
+		std::thread([&]() { signal.Emit(2); }).join();
+		threw = false;
+		try
+		{
+			(void)Elos::PumpMailbox();
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw && "Last message should throw");
+		std::thread([&]() { signal.Emit(5); }).join();
+		assert(Elos::PumpMailbox() == 1 && "Mailbox should keep working after a throw");
+		assert(seen == std::vector<int>({ 1, 2, 3, 4, 2, 5 }) && "Messages should keep their order");
+
+		const Elos::MailboxStats stats = mailbox->GetStats();
+		assert(stats.Executed - before.Executed == 6 && "Every message should be counted once");
+		assert(stats.Depth == 0 && "Mailbox should be drained");
+
+		std::println("Throwing queued slots passed!");
+	};
+
+	const auto TestNestedPump = []()
+	{
+		std::println("Testing nested mailbox pumps");
+
+		Elos::Signal<const std::vector<int>&> signal;
+		const auto mailbox = Elos::Mailbox::ForCurrentThread();
+		const auto postFromThread = [&](int v) { std::thread([&signal, v]() { signal.Emit({ v }); }).join(); };
+
+		std::vector<int> seen;
+		Elos::u64 nestedRan = 0;
+		auto connection = signal.Connect([&](const std::vector<int>& values)
+		{
+			seen.push_back(values.front());
+			if (values.front() == 1)
+			{
+				// A modal loop inside a slot: it finishes the current batch, newer posts wait
+				postFromThread(10);
+				nestedRan = Elos::PumpMailbox();
+				postFromThread(11);
+			}
+		}, mailbox);
+
+		postFromThread(1);
+		postFromThread(2);
+		assert(Elos::PumpMailbox() == 1 && "The outer pump should count only what it ran itself");
+		assert(nestedRan == 1 && seen == std::vector<int>({ 1, 2 }) && "The nested pump should finish the batch");
+
+		assert(Elos::PumpMailbox() == 2 && "Posts made during the nested pump should run next");
+		assert(seen == std::vector<int>({ 1, 2, 10, 11 }) && "Messages should keep their order");
+		assert(mailbox->GetStats().Depth == 0 && "Mailbox should be drained");
+
+		std::println("Nested mailbox pumps passed!");
+	};
+
+	const auto TestStaticSignal = []()
+	{
+		std::println("Testing static signal");
+
+		using FreeOnly = Elos::StaticSignal<&FreeSlot, [](int v) { g_freeSlotSum += v * 10; }>;
+		static_assert(FreeOnly::ConnectionCount() == 2, "Static signal should count its slots");
+		static_assert(std::is_empty_v<Elos::StaticSignal<&FreeSlot>> || sizeof(Elos::StaticSignal<&FreeSlot>) <= sizeof(void*),
+			"Static signal without member slots should carry no per-slot state");
+
+		FreeOnly freeOnly;
+		freeOnly.Emit(1);
+		freeOnly(2);
+		assert(g_freeSlotSum == 33 && "Free and lambda slots should be called");
+
+		Subsystem renderer;
+		Subsystem audio;
+		Elos::StaticSignal<&Subsystem::OnValue, &FreeSlot, &Subsystem::OnValue, &Subsystem::Peek> mixed(renderer, audio, audio);
+		mixed.Emit(5);
+		assert(renderer.Sum == 5 && audio.Sum == 5 && "Member slots should be bound in order");
+		assert(g_freeSlotSum == 38 && "Free slot should be called between member slots");
+
+		std::println("Static signal passed!");
+	};
+
+	const auto TestEmitRange = []()
+	{
+		std::println("Testing emit range");
+
+		Elos::Signal<const int&> signal;
+		std::vector<std::pair<char, int>> calls;
+		Elos::u64 batchCalls = 0;
+
+		auto perItem = signal.Connect([&calls](const int& v) { calls.emplace_back('a', v); });
+		auto batch = signal.Connect([&](std::span<const int> values)
+		{
+			++batchCalls;
+			for (int v : values)
+			{
+				calls.emplace_back('b', v);
+			}
+		});
+
+		const std::vector<int> values{ 1, 2, 3 };
+		signal.EmitRange(values);
+		assert(batchCalls == 1 && "Batch slot should receive the range in one call");
+		assert((calls == std::vector<std::pair<char, int>>{ { 'a', 1 }, { 'a', 2 }, { 'a', 3 }, { 'b', 1 }, { 'b', 2 }, { 'b', 3 } })
+			&& "Each slot should process the whole range before the next slot");
+
+		// Single emission reaches batch slots as a span of one
+		calls.clear();
+		signal.Emit(7);
+		assert(batchCalls == 2 && (calls == std::vector<std::pair<char, int>>{ { 'a', 7 }, { 'b', 7 } }) && "Emit should reach batch slots");
+
+		// A per-item slot that disconnects itself mid-range stops receiving the rest
+		Elos::Connection<const int&> self;
+		int selfCalls = 0;
+		self = signal.Connect([&](const int&)
+		{
+			if (++selfCalls == 2)
+			{
+				self.Disconnect();
+			}
+		});
+		signal.EmitRange(values);
+		assert(selfCalls == 2 && "Slot should stop once disconnected");
+
+		signal.EmitRange({});
+		assert(selfCalls == 2 && batchCalls == 3 && "Empty ranges should not call any slot");
+
+		std::println("Emit range passed!");
+	};
+
+	TestConnectAndEmit();
+	TestEmissionOrder();
+	TestStaleHandles();
+	TestDisconnectDuringEmit();
+	TestConnectDuringEmit();
+	TestLifetime();
+	TestConcurrentSignal();
+	TestQueuedConnection();
+	TestQueuedThrow();
+	TestNestedPump();
+	TestStaticSignal();
+	TestEmitRange();
+
+	return 0;
+}
@@ -0,0 +1,83 @@
+// Instrumentation is a build option, force it on so this test always covers it
+#if !defined(ELOS_SIGNAL_INSTRUMENTATION)
+	#define ELOS_SIGNAL_INSTRUMENTATION 1
+#endif
+#include <Elos/Event/Signal.h>
+#include <print>
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+int main()
+{
+	const auto TestSlotStats = []()
+	{
+		std::println("Testing per-slot stats");
+
+		Elos::Signal<int> signal("Test.Stats");
+		auto fast = signal.Connect([](int) {});
+		auto slow = signal.Connect([](int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+		for (int i = 0; i < 3; ++i)
+		{
+			signal.Emit(i);
+		}
+
+		const Elos::SlotStats fastStats = fast.GetStats();
+		const Elos::SlotStats slowStats = slow.GetStats();
+		assert(fastStats.Calls == 3 && slowStats.Calls == 3 && "Every call should be counted");
+		assert(slowStats.TotalMs >= 6.0 && slowStats.MaxMs >= 2.0 && "Slow slot time should be recorded");
+		assert(slowStats.TotalMs > fastStats.TotalMs && "Slow slot should dominate");
+		assert(std::accumulate(slowStats.Histogram.begin(), slowStats.Histogram.end(), Elos::u64{ 0 }) == 3 && "Histogram should hold every call");
+
+		// 2ms lands in the bucket bounded by 2^21ns (~2.1ms) or the one above it
+		const auto slowBucket = std::max_element(slowStats.Histogram.begin(), slowStats.Histogram.end()) - slowStats.Histogram.begin();
+		assert(slowBucket >= 21 && "Slow calls should land in a high bucket");
+
+		slow.Disconnect();
+		assert(slow.GetStats().Calls == 0 && "Disconnected slot should report nothing");
+
+		std::println("Per-slot stats passed!");
+	};
+
+	const auto TestRegistry = []()
+	{
+		std::println("Testing signal registry");
+
+		auto& registry = Elos::SignalRegistry::Get();
+		{
+			Elos::Signal<int> cheap("Test.Cheap");
+			Elos::Signal<int> costly("Test.Costly");
+			auto c1 = cheap.Connect([](int) {});
+			auto c2 = costly.Connect([](int) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+
+			cheap.Emit(0);
+			costly.Emit(0);
+
+			const auto names = registry.GetSignalNames();
+			assert(std::ranges::count(names, std::string("Test.Cheap")) == 1 && "Live signal should be listed");
+
+			// Moving a signal keeps it registered once, under its name
+			Elos::Signal<int> moved = std::move(costly);
+			assert(std::ranges::count(registry.GetSignalNames(), std::string("Test.Costly")) == 1 && "Moved signal should stay registered once");
+
+			const auto top = registry.GetTopOffenders(1);
+			assert(top.size() == 1 && top.front().Signal == "Test.Costly" && "Costly slot should be the top offender");
+			assert(top.front().Connection == c2.Id() && "Report should identify the connection");
+
+			registry.DumpTopOffenders(5);
+		}
+
+		const auto names = registry.GetSignalNames();
+		assert(std::ranges::count(names, std::string("Test.Cheap")) == 0 && "Destroyed signals should be unregistered");
+		assert(std::ranges::count(names, std::string("Test.Costly")) == 0 && "Destroyed signals should be unregistered");
+
+		std::println("Signal registry passed!");
+	};
+
+	TestSlotStats();
+	TestRegistry();
+
+	return 0;
+}
@@ -0,0 +1,231 @@
+#include <Elos/Window/WindowCommand.h>
+#include <Elos/Window/WindowCommandCoalescer.h>
+#include <Elos/Containers/ThreadSafePriorityQueue.h>
+#include <print>
+#include <cassert>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Records what a window thread would have done with each command
+	struct MockExecutor
+	{
+		std::vector<Elos::WindowCommandType> Executed;
+		Elos::WindowPosition                 Position{ 0, 0 };
+		Elos::WindowSize                     Size{ 0, 0 };
+		Elos::String                         Title;
+		bool                                 Visible = false;
+
+		void operator()(const Elos::WindowCommand::SetPosition& cmd) { Executed.push_back(Elos::WindowCommandType::SetPosition); Position = cmd.Position; }
+		void operator()(const Elos::WindowCommand::SetSize& cmd)     { Executed.push_back(Elos::WindowCommandType::SetSize); Size = cmd.Size; }
+		void operator()(const Elos::WindowCommand::SetTitle& cmd)    { Executed.push_back(Elos::WindowCommandType::SetTitle); Title = cmd.Title.View(); }
+		void operator()(const Elos::WindowCommand::SetVisible& cmd)  { Executed.push_back(Elos::WindowCommandType::SetVisible); Visible = cmd.Visible; }
+		void operator()(const Elos::WindowCommand::Create&)          { throw std::runtime_error("Create failed"); }
+
+		template <typename Other>
+		void operator()(const Other&) { Executed.push_back(Elos::WindowCommand{ Other{} }.GetType()); }
+	};
+}
+
+int main()
+{
+	const auto TestInlineString = []()
+	{
+		std::println("Testing InlineString");
+
+		Elos::WindowTitle title("Elos");
+		assert(title.IsInline() && title.View() == "Elos" && "Short text should stay inline");
+
+		const std::string longText(Elos::WindowTitle::GetCapacity() + 1, 'x');
+		Elos::WindowTitle spilled(longText);
+		assert(!spilled.IsInline() && spilled.View() == longText && "Long text should spill to the heap untruncated");
+
+		Elos::WindowTitle moved(std::move(title));
+		assert(moved.View() == "Elos" && title.Empty() && "Moving should leave the source empty");
+
+		moved = std::move(spilled);
+		assert(!moved.IsInline() && moved.View() == longText && spilled.Empty() && "Move assignment should take over the heap block");
+
+		std::println("InlineString passed!");
+	};
+
+	const auto TestCommandDispatch = []()
+	{
+		std::println("Testing WindowCommand dispatch");
+
+		MockExecutor executor;
+		Elos::WindowCommand position{ Elos::WindowCommand::SetPosition{ { 10, 20 } } };
+		Elos::WindowCommand size{ Elos::WindowCommand::SetSize{ { 640, 480 } } };
+		Elos::WindowCommand title{ Elos::WindowCommand::SetTitle{ Elos::WindowTitle("Editor") } };
+		Elos::WindowCommand visible{ Elos::WindowCommand::SetVisible{ true } };
+		Elos::WindowCommand redraw{ Elos::WindowCommand::Redraw{} };
+		assert(title.GetType() == Elos::WindowCommandType::SetTitle && "GetType should follow the payload");
+
+		for (Elos::WindowCommand* cmd : { &position, &size, &title, &visible, &redraw })
+		{
+			Elos::ExecuteWindowCommand(*cmd, executor);
+		}
+
+		assert(executor.Executed.size() == 5 && executor.Executed.back() == Elos::WindowCommandType::Redraw && "Every command should reach its overload");
+		assert(executor.Position.X == 10 && executor.Position.Y == 20 && "SetPosition payload should arrive intact");
+		assert(executor.Size.Width == 640 && executor.Size.Height == 480 && "SetSize payload should arrive intact");
+		assert(executor.Title == "Editor" && executor.Visible && "SetTitle and SetVisible payloads should arrive intact");
+
+		// Completion is fulfilled after the command ran
+		std::promise<void> done;
+		std::future<void> doneFuture = done.get_future();
+		Elos::WindowCommand close{ Elos::WindowCommand::Close{}, &done };
+		Elos::ExecuteWindowCommand(close, executor);
+		assert(doneFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready && "Completion should be set");
+		assert(executor.Executed.back() == Elos::WindowCommandType::Close && "Close should run before completion");
+
+		// A failure reaches the waiter instead of the window thread
+		std::promise<void> failed;
+		std::future<void> failedFuture = failed.get_future();
+		Elos::WindowCommand create{ Elos::WindowCommand::Create{}, &failed };
+		Elos::ExecuteWindowCommand(create, executor);
+		bool threw = false;
+		try
+		{
+			failedFuture.get();
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw && "The waiter should receive the executor's exception");
+
+		// Without a waiter it propagates
+		Elos::WindowCommand unwaited{ Elos::WindowCommand::Create{} };
+		threw = false;
+		try
+		{
+			Elos::ExecuteWindowCommand(unwaited, executor);
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw && "An exception without a waiter should propagate");
+
+		std::println("WindowCommand dispatch passed!");
+	};
+
+	const auto TestCommandOrder = []()
+	{
+		std::println("Testing WindowCommand ordering");
+
+		Elos::ThreadSafePriorityQueue<Elos::WindowCommand, Elos::WindowCommandOrder> queue;
+		queue.Push(Elos::WindowCommand{ Elos::WindowCommand::Redraw{} });
+		queue.Push(Elos::WindowCommand{ Elos::WindowCommand::SetSize{ { 1, 1 } } });
+		queue.Push(Elos::WindowCommand{ Elos::WindowCommand::SetTitle{ Elos::WindowTitle("A") } });
+		queue.Push(Elos::WindowCommand{ Elos::WindowCommand::Close{} });
+
+		std::vector<Elos::WindowCommandType> order;
+		while (std::optional<Elos::WindowCommand> cmd = queue.TryPop())
+		{
+			order.push_back(cmd->GetType());
+		}
+
+		const std::vector<Elos::WindowCommandType> expected
+		{
+			Elos::WindowCommandType::SetSize,
+			Elos::WindowCommandType::SetTitle,
+			Elos::WindowCommandType::Close,
+			Elos::WindowCommandType::Redraw
+		};
+		assert(order == expected && "Close should overtake redraws but not the state commands queued before it");
+
+		std::println("WindowCommand ordering passed!");
+	};
+
+	const auto TestCoalescing = []()
+	{
+		std::println("Testing WindowCommandCoalescer");
+
+		using Elos::WindowCommand;
+		using Type = Elos::WindowCommandType;
+
+		// Last writer wins, one redraw after the final state
+		{
+			Elos::WindowCommandCoalescer coalescer;
+			coalescer.Add(WindowCommand{ WindowCommand::SetSize{ { 1, 1 } } });
+			coalescer.Add(WindowCommand{ WindowCommand::SetPosition{ { 5, 5 } } });
+			coalescer.Add(WindowCommand{ WindowCommand::SetSize{ { 2, 2 } } });
+			coalescer.Add(WindowCommand{ WindowCommand::Redraw{} });
+			coalescer.Add(WindowCommand{ WindowCommand::SetSize{ { 3, 3 } } });
+			coalescer.Add(WindowCommand{ WindowCommand::RequestFocus{} });
+			coalescer.Add(WindowCommand{ WindowCommand::Redraw{} });
+			coalescer.Add(WindowCommand{ WindowCommand::Redraw{} });
+
+			MockExecutor executor;
+			coalescer.Execute(executor);
+			const std::vector<Type> expected{ Type::SetPosition, Type::SetSize, Type::RequestFocus, Type::Redraw };
+			assert(executor.Executed == expected && "Only the last of each state command and one redraw should run");
+			assert(executor.Size.Width == 3 && "The surviving SetSize should carry the last value");
+			assert(coalescer.GetElidedCount() == 4 && coalescer.Empty() && "Elided commands should be counted");
+		}
+
+		// Create and Close are barriers
+		{
+			Elos::WindowCommandCoalescer coalescer;
+			coalescer.Add(WindowCommand{ WindowCommand::SetTitle{ Elos::WindowTitle("Before") } });
+			coalescer.Add(WindowCommand{ WindowCommand::Close{} });
+			coalescer.Add(WindowCommand{ WindowCommand::SetTitle{ Elos::WindowTitle("After") } });
+			coalescer.Add(WindowCommand{ WindowCommand::SetTitle{ Elos::WindowTitle("Final") } });
+
+			MockExecutor executor;
+			coalescer.Execute(executor);
+			const std::vector<Type> expected{ Type::SetTitle, Type::Close, Type::SetTitle };
+			assert(executor.Executed == expected && "Commands shouldn't merge across a barrier");
+			assert(executor.Title == "Final" && coalescer.GetElidedCount() == 1 && "Only the title after the barrier should merge");
+		}
+
+		// A command someone waits on always runs
+		{
+			std::promise<void> shown;
+			std::future<void> shownFuture = shown.get_future();
+
+			Elos::WindowCommandCoalescer coalescer;
+			coalescer.Add(WindowCommand{ WindowCommand::SetVisible{ true }, &shown });
+			coalescer.Add(WindowCommand{ WindowCommand::SetVisible{ false } });
+
+			MockExecutor executor;
+			coalescer.Execute(executor);
+			assert(executor.Executed.size() == 2 && !executor.Visible && coalescer.GetElidedCount() == 0 && "Waited-on commands shouldn't be elided");
+			assert(shownFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready && "Its waiter should be released");
+		}
+
+		// Draining a queue keeps priority order, then coalesces
+		{
+			Elos::ThreadSafePriorityQueue<WindowCommand, Elos::WindowCommandOrder> queue;
+			for (Elos::u32 i = 1; i <= 100; ++i)
+			{
+				queue.Push(WindowCommand{ WindowCommand::SetSize{ { i, i } } });
+				queue.Push(WindowCommand{ WindowCommand::Redraw{} });
+			}
+
+			Elos::WindowCommandCoalescer coalescer;
+			assert(coalescer.AddFrom(queue) == 200 && queue.Empty() && "AddFrom should drain the queue");
+
+			MockExecutor executor;
+			coalescer.Execute(executor);
+			const std::vector<Type> expected{ Type::SetSize, Type::Redraw };
+			assert(executor.Executed == expected && executor.Size.Width == 100 && "A resize burst should apply once");
+			assert(coalescer.GetElidedCount() == 198 && "Every superseded command should be counted");
+		}
+
+		std::println("WindowCommandCoalescer passed!");
+	};
+
+	TestInlineString();
+	TestCommandDispatch();
+	TestCommandOrder();
+	TestCoalescing();
+
+	return 0;
+}
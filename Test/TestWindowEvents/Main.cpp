@@ -0,0 +1,315 @@
+#include <Elos/Window/EventLatencyTracker.h>
+#include <Elos/Window/WindowEventQueue.h>
+#include <print>
+#include <cassert>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	const auto TestOrderAndBatches = []()
+	{
+		std::println("Testing WindowEventQueue order and batches");
+
+		Elos::WindowEventQueue queue;
+		for (Elos::i32 i = 0; i < 10; ++i)
+		{
+			queue.Push(Elos::Event::MouseMoved{ i, i });
+		}
+		queue.Push(Elos::Event::Closed{});
+		assert(queue.Size() == 11 && "Every push should be pending");
+
+		const std::optional<Elos::Event> first = queue.TryPop();
+		assert(first && first->Get<Elos::Event::MouseMoved>()->X == 0 && "TryPop should return the oldest event");
+
+		std::array<Elos::Event, 4> batch;
+		assert(queue.PopBatch(batch) == 4 && "PopBatch should fill the span");
+		assert(batch[0].Get<Elos::Event::MouseMoved>()->X == 1 && batch[3].Get<Elos::Event::MouseMoved>()->X == 4 && "PopBatch should keep order");
+
+		std::vector<Elos::Event> rest{ Elos::Event::FocusLost{} };
+		assert(queue.SwapOut(rest) == 6 && rest.size() == 6 && "SwapOut should replace the vector's contents");
+		assert(rest.back().Is<Elos::Event::Closed>() && "SwapOut should keep order");
+		assert(queue.Empty() && !queue.TryPop() && "The queue should be drained");
+
+		assert(queue.GetCounters().HighWater == 11 && "HighWater should be the deepest the queue has been");
+
+		std::println("WindowEventQueue order and batches passed!");
+	};
+
+	const auto TestOverflowAndClear = []()
+	{
+		std::println("Testing WindowEventQueue overflow and clear");
+
+		constexpr Elos::u64 text = Elos::WindowEventQueue::Capacity + 10;
+		const auto fill = [](Elos::WindowEventQueue& queue)
+		{
+			for (Elos::u64 i = 0; i < text; ++i)
+			{
+				queue.Push(Elos::Event::TextInput{ static_cast<Elos::char32>(i) });
+			}
+			queue.Push(Elos::Event::KeyReleased{ Elos::KeyCode::Escape, false, false, false, false });
+			queue.Push(Elos::Event::Closed{});
+		};
+
+		Elos::WindowEventQueue queue;
+		fill(queue);
+		assert(queue.Size() == text + 2 && "A full ring should spill instead of dropping");
+		assert(queue.GetCounters().Dropped == 0 && queue.GetCounters().HighWater == text + 2 && "HighWater should count spilled events");
+
+		// Drain in odd-sized batches so a batch straddles the end of the ring
+		std::array<Elos::Event, 100> batch;
+		std::vector<Elos::Event> drained;
+		while (const Elos::u64 popped = queue.PopBatch(batch))
+		{
+			drained.insert(drained.end(), batch.begin(), batch.begin() + popped);
+		}
+		bool ordered = drained.size() == text + 2;
+		for (Elos::u64 i = 0; ordered && i < text; ++i)
+		{
+			const auto* input = drained[i].Get<Elos::Event::TextInput>();
+			ordered = input && input->UnicodeChar == static_cast<Elos::char32>(i);
+		}
+		assert(ordered && "Spilled events should follow the ring's in order");
+		assert(drained[text].Is<Elos::Event::KeyReleased>() && drained[text + 1].Is<Elos::Event::Closed>() && "Events arriving at a full ring should not be lost");
+		assert(queue.Empty() && "The queue should be drained");
+
+		// Back on the ring once the overflow is gone
+		queue.Push(Elos::Event::FocusGained{});
+		assert(queue.TryPop()->Is<Elos::Event::FocusGained>() && queue.Empty() && "The ring should be used again after a spill");
+
+		fill(queue);
+		std::vector<Elos::Event> all;
+		assert(queue.SwapOut(all) == text + 2 && all.back().Is<Elos::Event::Closed>() && "SwapOut should take the overflow too");
+
+		fill(queue);
+		queue.Clear();
+		assert(queue.Empty() && !queue.TryPop() && "Clear should drop everything");
+
+		Elos::QueueTelemetry& telemetry = queue.EnableTelemetry();
+		queue.Push(Elos::Event::FocusGained{});
+		queue.Push(Elos::Event::FocusLost{});
+		assert(telemetry.GetStats().Pushed == 2 && telemetry.GetStats().HighWater == 2 && "Telemetry should see pushes and depth");
+
+		std::println("WindowEventQueue overflow and clear passed!");
+	};
+
+	const auto TestProducerConsumer = []()
+	{
+		std::println("Testing WindowEventQueue across threads");
+
+		Elos::WindowEventQueue queue;
+		constexpr Elos::i32 count = 200'000;
+		std::atomic<Elos::i32> pushed{ 0 };
+
+		std::thread producer([&]()
+		{
+			for (Elos::i32 i = 0; i < count; ++i)
+			{
+				queue.Push(Elos::Event::MouseMoved{ i, -i });
+				pushed.store(i + 1, std::memory_order_release);
+			}
+		});
+
+		std::array<Elos::Event, 64> batch;
+		Elos::i32 expected = 0;
+		bool ordered = true;
+		while (expected < count)
+		{
+			const Elos::u64 popped = queue.PopBatch(batch);
+			for (Elos::u64 i = 0; i < popped; ++i)
+			{
+				const auto* moved = batch[i].Get<Elos::Event::MouseMoved>();
+				ordered = ordered && moved && moved->X == expected && moved->Y == -expected;
+				++expected;
+			}
+			if (popped == 0)
+			{
+				std::this_thread::yield();
+			}
+		}
+		producer.join();
+
+		assert(ordered && "Every event should arrive once, intact and in order");
+		assert(queue.Empty() && pushed.load() == count && "Nothing should be left over");
+
+		std::println("WindowEventQueue across threads passed!");
+	};
+
+	const auto TestCoalescerRules = []()
+	{
+		std::println("Testing WindowEventCoalescer rules");
+
+		Elos::WindowEventCoalescer coalescer;
+		std::vector<Elos::Event> published;
+		const auto publish = [&](const Elos::Event& event) { published.push_back(event); };
+
+		coalescer.Add(Elos::Event::MouseMoved{ 1, 1 }, publish);
+		coalescer.Add(Elos::Event::MouseMovedRaw{ 2, -1 }, publish);
+		coalescer.Add(Elos::Event::MouseMoved{ 5, 6 }, publish);
+		coalescer.Add(Elos::Event::MouseMovedRaw{ 3, -2 }, publish);
+		coalescer.Add(Elos::Event::MouseWheelScrolled{ Elos::KeyCode::MouseWheel::Vertical, 1.0f, 1, 1 }, publish);
+		coalescer.Add(Elos::Event::MouseWheelScrolled{ Elos::KeyCode::MouseWheel::Horizontal, 0.5f, 2, 2 }, publish);
+		coalescer.Add(Elos::Event::MouseWheelScrolled{ Elos::KeyCode::MouseWheel::Vertical, -3.0f, 7, 8 }, publish);
+		coalescer.Add(Elos::Event::Resized{ 10, 10 }, publish);
+		coalescer.Add(Elos::Event::Resized{ 20, 30 }, publish);
+		assert(published.empty() && coalescer.GetHeldCount() == 5 && "High-frequency input should be held, one event per kind and axis");
+
+		coalescer.Flush(publish);
+		assert(coalescer.Empty() && published.size() == 5 && "Flush should publish everything held");
+
+		const auto* moved = published[0].Get<Elos::Event::MouseMoved>();
+		assert(moved && moved->X == 5 && moved->Y == 6 && "A move should keep the latest position");
+		const auto* raw = published[1].Get<Elos::Event::MouseMovedRaw>();
+		assert(raw && raw->DeltaX == 5 && raw->DeltaY == -3 && "Raw deltas should add up");
+		const auto* vertical = published[2].Get<Elos::Event::MouseWheelScrolled>();
+		assert(vertical && vertical->Delta == -2.0f && vertical->X == 7 && vertical->Y == 8 && "Wheel deltas should add up per axis");
+		const auto* horizontal = published[3].Get<Elos::Event::MouseWheelScrolled>();
+		assert(horizontal && horizontal->Delta == 0.5f && "Another axis should be held separately");
+		const auto* resized = published[4].Get<Elos::Event::Resized>();
+		assert(resized && resized->Size.Width == 20 && resized->Size.Height == 30 && "A resize should keep the latest size");
+
+		const Elos::EventMergeCounters counters = coalescer.GetCounters();
+		assert(counters.MouseMoved == 1 && counters.MouseMovedRaw == 1 && counters.MouseWheel == 1 && counters.Resized == 1 && "Every merge should be counted by kind");
+		assert(counters.Total() == 4 && "Total should add up every kind");
+
+		std::println("WindowEventCoalescer rules passed!");
+	};
+
+	const auto TestCoalescerOrder = []()
+	{
+		std::println("Testing WindowEventCoalescer order around other events");
+
+		Elos::WindowEventCoalescer coalescer;
+		std::vector<Elos::Event> published;
+		const auto publish = [&](const Elos::Event& event) { published.push_back(event); };
+
+		coalescer.Add(Elos::Event::MouseMoved{ 1, 1 }, publish);
+		coalescer.Add(Elos::Event::MouseMoved{ 2, 2 }, publish);
+		coalescer.Add(Elos::Event::MouseButtonPressed{ Elos::KeyCode::MouseButton::Left, 2, 2 }, publish);
+		coalescer.Add(Elos::Event::MouseMoved{ 3, 3 }, publish);
+		coalescer.Add(Elos::Event::MouseMoved{ 4, 4 }, publish);
+		coalescer.Add(Elos::Event::MouseButtonReleased{ Elos::KeyCode::MouseButton::Left, 4, 4 }, publish);
+		coalescer.Add(Elos::Event::KeyPressed{ Elos::KeyCode::A, false, false, false, false }, publish);
+		coalescer.Flush(publish);
+
+		assert(published.size() == 5 && "Moves on either side of a click must not merge across it");
+		assert(published[0].Get<Elos::Event::MouseMoved>()->X == 2 && "The run before the press should publish first");
+		assert(published[1].Is<Elos::Event::MouseButtonPressed>() && "The press should follow the moves before it");
+		assert(published[2].Get<Elos::Event::MouseMoved>()->X == 4 && "The run between press and release should publish between them");
+		assert(published[3].Is<Elos::Event::MouseButtonReleased>() && published[4].Is<Elos::Event::KeyPressed>() && "Other events should keep their order");
+
+		std::println("WindowEventCoalescer order around other events passed!");
+	};
+
+	const auto TestQueueCoalescing = []()
+	{
+		std::println("Testing WindowEventQueue coalescing");
+
+		Elos::WindowEventQueue queue;
+		assert(!queue.IsCoalescing() && "Coalescing should be off by default");
+
+		queue.SetCoalescing(true);
+		for (Elos::i32 i = 0; i < 100; ++i)
+		{
+			queue.Push(Elos::Event::MouseMoved{ i, i });
+		}
+		assert(queue.Empty() && queue.HasHeldEvents() && "Coalesced moves should wait for a flush");
+
+		queue.Flush();
+		assert(queue.Size() == 1 && queue.TryPop()->Get<Elos::Event::MouseMoved>()->X == 99 && "A flush should publish the latest move");
+		assert(queue.GetCounters().Coalesced == 99 && queue.GetMergeCounters().MouseMoved == 99 && "Merged moves should be counted");
+
+		// Switching off publishes whatever is held ahead of the next event
+		queue.Push(Elos::Event::Resized{ 1, 1 });
+		queue.SetCoalescing(false);
+		queue.Push(Elos::Event::MouseMoved{ 1, 1 });
+		queue.Push(Elos::Event::MouseMoved{ 2, 2 });
+		assert(queue.Size() == 3 && !queue.HasHeldEvents() && "Without coalescing every event should be queued");
+		assert(queue.TryPop()->Is<Elos::Event::Resized>() && "Held events should come first");
+
+		std::println("WindowEventQueue coalescing passed!");
+	};
+
+	const auto TestTimestamps = []()
+	{
+		std::println("Testing Event timestamps");
+
+		const Elos::Timer::TimePoint start = Elos::Timer::Now();
+		Elos::Event event = Elos::Event::KeyPressed{ Elos::KeyCode::A, false, false, false, false };
+		assert(!event.HasTimestamp() && "An event should start without a timestamp");
+		event.SetTimestamp(start);
+		assert(event.HasTimestamp() && event.GetTimestamp() == start && "SetTimestamp should stick");
+		assert(Elos::Event(Elos::Event::Closed{}, start).GetTimestamp() == start && "The constructor should take a timestamp");
+		assert(event.GetTypeIndex() == Elos::Event::TypeIndexOf<Elos::Event::KeyPressed>() && "Type indices should match");
+
+		// A default-constructed event is empty rather than any real event
+		const Elos::Event empty;
+		assert(empty.IsEmpty() && !empty.Is<Elos::Event::Closed>() && "A default event should hold no event");
+		assert(!empty.HasTimestamp() && empty.GetTypeIndex() == 0 && "A default event should have no timestamp or type");
+		assert(Elos::Event::TypeIndexOf<Elos::Event::Closed>() != 0 && !event.IsEmpty() && "Real events should not be empty");
+
+		// A merged event keeps its oldest input's time
+		Elos::WindowEventCoalescer coalescer;
+		std::vector<Elos::Event> published;
+		const auto publish = [&](const Elos::Event& ready) { published.push_back(ready); };
+		coalescer.Add(Elos::Event(Elos::Event::MouseMoved{ 1, 1 }, start), publish);
+		coalescer.Add(Elos::Event(Elos::Event::MouseMoved{ 2, 2 }, start + std::chrono::milliseconds(5)), publish);
+		coalescer.Flush(publish);
+		assert(published.size() == 1 && published[0].GetTimestamp() == start && "A merge should keep the earliest timestamp");
+		assert(published[0].Get<Elos::Event::MouseMoved>()->X == 2 && "A merge should still take the latest position");
+
+		// Queue telemetry times stamped events only
+		Elos::WindowEventQueue queue;
+		Elos::QueueTelemetry& telemetry = queue.EnableTelemetry();
+		queue.Push(Elos::Event(Elos::Event::FocusGained{}, Elos::Timer::Now() - std::chrono::milliseconds(2)));
+		queue.Push(Elos::Event::FocusLost{});
+		std::array<Elos::Event, 4> batch;
+		assert(queue.PopBatch(batch) == 2 && "Both events should be polled");
+		const Elos::QueueStats stats = telemetry.GetStats();
+		assert(stats.Popped == 1 && stats.MaxLatencyMs >= 2.0 && "Latency should run from the event's timestamp");
+
+		std::println("Event timestamps passed!");
+	};
+
+	const auto TestLatencyTracker = []()
+	{
+		std::println("Testing EventLatencyTracker");
+
+		const Elos::Timer::TimePoint now = Elos::Timer::Now();
+		const std::array<Elos::Event, 4> events
+		{
+			Elos::Event(Elos::Event::MouseMoved{ 0, 0 }, now - std::chrono::microseconds(100)),
+			Elos::Event(Elos::Event::MouseMoved{ 1, 1 }, now - std::chrono::microseconds(300)),
+			Elos::Event(Elos::Event::KeyPressed{ Elos::KeyCode::A, false, false, false, false }, now - std::chrono::milliseconds(4)),
+			Elos::Event(Elos::Event::Closed{})
+		};
+
+		Elos::EventLatencyTracker tracker;
+		tracker.Record(events, now);
+		const Elos::EventLatencyStats stats = tracker.GetStats();
+		assert(stats.All.Count == 3 && "Events without a timestamp should be skipped");
+		assert(stats.For<Elos::Event::MouseMoved>().Count == 2 && stats.For<Elos::Event::KeyPressed>().Count == 1 && "Latency should be kept per event type");
+		assert(stats.For<Elos::Event::Closed>().Count == 0 && "Unstamped types should have no samples");
+		assert(stats.For<Elos::Event::KeyPressed>().MaxMs >= 3.99 && stats.For<Elos::Event::KeyPressed>().MaxMs <= 4.01 && "Latency should run from receipt to dispatch");
+		assert(stats.For<Elos::Event::MouseMoved>().PercentileNs(0.99) >= 300'000 && "Percentiles should cover the slowest move");
+
+		tracker.Reset();
+		assert(tracker.GetStats().All.Count == 0 && "Reset should clear every histogram");
+
+		std::println("EventLatencyTracker passed!");
+	};
+
+	TestOrderAndBatches();
+	TestOverflowAndClear();
+	TestProducerConsumer();
+	TestCoalescerRules();
+	TestCoalescerOrder();
+	TestQueueCoalescing();
+	TestTimestamps();
+	TestLatencyTracker();
+
+	return 0;
+}
@@ -0,0 +1,535 @@
+#include <Elos/Window/BasicWindowHost.h>
+#include <print>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// A message queue that never has messages, only the wake signal
+	class StandInMessageSource
+	{
+	public:
+		bool PumpMessages() { return true; }
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled; });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+			}
+			m_condVar.notify_one();
+		}
+
+		// Hooks the host runs on its own thread around the loop
+		void EnterThread() { s_entered.fetch_add(1); }
+		void LeaveThread() { s_left.fetch_add(1); }
+
+		static inline std::atomic<int> s_entered{ 0 };
+		static inline std::atomic<int> s_left{ 0 };
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		bool                    m_signaled = false;
+	};
+
+	// Records what the host ran for it; only touched on the host thread until a PostAndWait returns
+	struct StandInWindow
+	{
+		std::set<std::thread::id> Threads;
+		Elos::WindowSize          Size{ 0, 0 };
+		Elos::u32                 Executed   = 0;
+		bool                      FailCreate = false;
+
+		void Execute(const Elos::WindowCommand::Create&)
+		{
+			if (FailCreate)
+			{
+				throw std::runtime_error("Create failed");
+			}
+			Record();
+		}
+
+		void Execute(const Elos::WindowCommand::SetSize& cmd)
+		{
+			Size = cmd.Size;
+			Record();
+		}
+
+		template <typename Payload>
+		void Execute(const Payload&)
+		{
+			Record();
+		}
+
+		void Record()
+		{
+			Threads.insert(std::this_thread::get_id());
+			++Executed;
+		}
+	};
+
+	using Host = Elos::BasicWindowHost<StandInMessageSource, StandInWindow>;
+
+	// Asks its host for a flush from a command, the way a message handler holding coalesced events would
+	struct FlushingWindow
+	{
+		std::function<void()>  Defer;
+		std::atomic<Elos::u32> Flushes{ 0 };
+
+		template <typename Payload>
+		void Execute(const Payload&)
+		{
+			Defer();
+		}
+
+		void FlushEvents() { Flushes.fetch_add(1); }
+	};
+
+	using FlushingHost = Elos::BasicWindowHost<StandInMessageSource, FlushingWindow>;
+
+	// Records the order commands ran in
+	struct OrderedWindow
+	{
+		std::vector<Elos::WindowCommandType> Order;
+
+		void Execute(const Elos::WindowCommand::SetVisible&) { Order.push_back(Elos::WindowCommandType::SetVisible); }
+		void Execute(const Elos::WindowCommand::RequestFocus&) { Order.push_back(Elos::WindowCommandType::RequestFocus); }
+		void Execute(const Elos::WindowCommand::SetTitle&) { Order.push_back(Elos::WindowCommandType::SetTitle); }
+		void Execute(const Elos::WindowCommand::Close&) { Order.push_back(Elos::WindowCommandType::Close); }
+		void Execute(const Elos::WindowCommand::Redraw&) { Order.push_back(Elos::WindowCommandType::Redraw); }
+
+		template <typename Payload>
+		void Execute(const Payload&)
+		{
+		}
+	};
+
+	using OrderedHost = Elos::BasicWindowHost<StandInMessageSource, OrderedWindow>;
+
+	// Holds the host thread inside a command until released, like a slow Win32 call
+	struct BlockingWindow
+	{
+		std::mutex              Mutex;
+		std::condition_variable CondVar;
+		bool                    Entered  = false;
+		bool                    Released = false;
+		std::atomic<bool>       Finished{ false };
+
+		void Execute(const Elos::WindowCommand::Redraw&)
+		{
+			std::unique_lock<std::mutex> lock(Mutex);
+			Entered = true;
+			CondVar.notify_all();
+			CondVar.wait(lock, [this] { return Released; });
+			Finished = true;
+		}
+
+		template <typename Payload>
+		void Execute(const Payload&)
+		{
+		}
+
+		void WaitUntilEntered()
+		{
+			std::unique_lock<std::mutex> lock(Mutex);
+			CondVar.wait(lock, [this] { return Entered; });
+		}
+
+		void Release()
+		{
+			{
+				std::lock_guard<std::mutex> lock(Mutex);
+				Released = true;
+			}
+			CondVar.notify_all();
+		}
+	};
+
+	using BlockingHost = Elos::BasicWindowHost<StandInMessageSource, BlockingWindow>;
+}
+
+int main()
+{
+	const auto TestRouting = []()
+	{
+		std::println("Testing BasicWindowHost routing");
+
+		Host host;
+		std::vector<StandInWindow> windows(8);
+		std::vector<Elos::WindowId> ids;
+		for (StandInWindow& window : windows)
+		{
+			ids.push_back(host.Attach(window));
+		}
+		assert(host.GetWindowCount() == windows.size() && "Every window should be attached");
+
+		for (Elos::u32 i = 0; i < ids.size(); ++i)
+		{
+			host.Post(ids[i], Elos::WindowCommand::SetSize{ { i + 1, i + 1 } });
+		}
+		for (const Elos::WindowId id : ids)
+		{
+			host.PostAndWait(id, Elos::WindowCommand::Redraw{});
+		}
+
+		for (Elos::u32 i = 0; i < windows.size(); ++i)
+		{
+			assert(windows[i].Size.Width == i + 1 && "Each command should reach the window it was posted for");
+			assert(windows[i].Threads.size() == 1 && *windows[i].Threads.begin() == host.GetThreadId() && "Commands should run on the host thread");
+		}
+
+		std::println("BasicWindowHost routing passed!");
+	};
+
+	const auto TestPerWindowCoalescing = []()
+	{
+		std::println("Testing BasicWindowHost per-window coalescing");
+
+		Host host;
+		StandInWindow a;
+		StandInWindow b;
+		const Elos::WindowId idA = host.Attach(a);
+		const Elos::WindowId idB = host.Attach(b);
+
+		constexpr Elos::u32 burst = 1'000;
+		for (Elos::u32 i = 1; i <= burst; ++i)
+		{
+			host.Post(idA, Elos::WindowCommand::SetSize{ { i, i } });
+			host.Post(idB, Elos::WindowCommand::SetSize{ { i * 2, i * 2 } });
+		}
+		host.PostAndWait(idA, Elos::WindowCommand::Close{});
+		host.PostAndWait(idB, Elos::WindowCommand::Close{});
+
+		assert(a.Size.Width == burst && b.Size.Width == burst * 2 && "One window's commands must not override another's");
+		assert(a.Executed + host.GetElidedCommandCount(idA) == burst + 1 && "Every command for a should run or be counted as elided");
+		assert(b.Executed + host.GetElidedCommandCount(idB) == burst + 1 && "Every command for b should run or be counted as elided");
+
+		std::println("BasicWindowHost per-window coalescing passed!");
+	};
+
+	const auto TestDetachAndErrors = []()
+	{
+		std::println("Testing BasicWindowHost detach and errors");
+
+		Host host;
+		StandInWindow window;
+		window.FailCreate = true;
+		const Elos::WindowId id = host.Attach(window);
+
+		bool threw = false;
+		try
+		{
+			host.PostAndWait(id, Elos::WindowCommand::Create{});
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		assert(threw && "A failing command should rethrow in the waiting caller");
+
+		host.Detach(id);
+		assert(host.GetWindowCount() == 0 && "Detach should remove the window");
+
+		// Commands for a detached window are dropped, but their waiters still return
+		host.PostAndWait(id, Elos::WindowCommand::Close{});
+		assert(window.Executed == 0 && "A detached window must not be touched");
+
+		std::println("BasicWindowHost detach and errors passed!");
+	};
+
+	const auto TestThreadHooks = []()
+	{
+		std::println("Testing BasicWindowHost thread hooks");
+
+		const int enteredBefore = StandInMessageSource::s_entered.load();
+		const int leftBefore = StandInMessageSource::s_left.load();
+
+		auto host = std::make_unique<Host>();
+		StandInWindow window;
+		const Elos::WindowId id = host->Attach(window);
+		host->PostAndWait(id, Elos::WindowCommand::Redraw{});
+		assert(StandInMessageSource::s_entered.load() == enteredBefore + 1 && "EnterThread should run before the first command");
+		assert(host->GetPassCount() >= 1 && "The host loop should have run");
+
+		host.reset();
+		assert(StandInMessageSource::s_left.load() == leftBefore + 1 && "LeaveThread should run once the host stops");
+
+		std::println("BasicWindowHost thread hooks passed!");
+	};
+
+	const auto TestCommandBatch = []()
+	{
+		std::println("Testing BasicWindowCommandBatch");
+
+		Host host;
+		StandInWindow window;
+		const Elos::WindowId id = host.Attach(window);
+
+		Elos::BasicWindowCommandBatch<Host> batch(&host, id);
+		batch.SetPosition({ 1, 2 }).SetTitle("A title").SetSize({ 3, 4 });
+		assert(batch.GetSize() == 3 && "Every call should add a command");
+
+		const Elos::WindowCommandToken token = batch.Submit();
+		assert(batch.GetSize() == 0 && "Submit should leave the batch empty");
+		token.Wait();
+		assert(token.IsDone() && "A token should be done once Wait returns");
+		assert(window.Size.Width == 3 && window.Executed == 3 && "Every command of the batch should have run");
+
+		// Empty batches and batches without a host are done straight away
+		assert(batch.Submit().IsDone() && "An empty batch should complete immediately");
+		assert(Elos::BasicWindowCommandBatch<Host>(nullptr, id).Redraw().Submit().IsDone() && "A batch without a host should complete immediately");
+
+		// Ignored tokens don't hold anything up, and later tokens cover earlier batches
+		std::vector<Elos::WindowCommandToken> tokens;
+		for (Elos::u32 i = 1; i <= 100; ++i)
+		{
+			Elos::BasicWindowCommandBatch<Host>(&host, id).SetSize({ i, i }).Redraw().Submit();
+			tokens.push_back(batch.SetSize({ i, i }).Submit());
+		}
+		tokens.back().Wait();
+		for (const Elos::WindowCommandToken& earlier : tokens)
+		{
+			assert(earlier.IsDone() && "Batches run in the order they were submitted");
+		}
+		assert(window.Size.Width == 100 && "The last batch should win");
+
+		// Batches for a detached window are dropped but still complete
+		host.Detach(id);
+		Elos::BasicWindowCommandBatch<Host>(&host, id).Redraw().Submit().Wait();
+
+		std::println("BasicWindowCommandBatch passed!");
+	};
+
+	const auto TestConcurrentBatches = []()
+	{
+		std::println("Testing BasicWindowHost concurrent batches");
+
+		auto host = std::make_unique<Host>();
+		std::vector<StandInWindow> windows(4);
+		std::vector<std::thread> submitters;
+		std::atomic<bool> allDone{ true };
+		for (StandInWindow& window : windows)
+		{
+			const Elos::WindowId id = host->Attach(window);
+			submitters.emplace_back([&, id]()
+			{
+				Elos::BasicWindowCommandBatch<Host> batch(host.get(), id);
+				for (Elos::u32 i = 1; i <= 500; ++i)
+				{
+					const Elos::WindowCommandToken token = batch.SetSize({ i, i }).Redraw().Submit();
+					if (i % 50 == 0)
+					{
+						token.Wait();
+						allDone = allDone && token.IsDone();
+					}
+				}
+			});
+		}
+		for (std::thread& submitter : submitters)
+		{
+			submitter.join();
+		}
+		assert(allDone && "Every awaited token should be done");
+		for (const StandInWindow& window : windows)
+		{
+			assert(window.Size.Width == 500 && "Each submitter's last batch should have run for its window");
+		}
+
+		// A token outliving its host counts as done
+		const Elos::WindowCommandToken late = Elos::BasicWindowCommandBatch<Host>(host.get(), 1).Redraw().Submit();
+		host.reset();
+		late.Wait();
+		assert(late.IsDone() && "Stopping the host should release its tokens");
+
+		std::println("BasicWindowHost concurrent batches passed!");
+	};
+
+	const auto TestPool = []()
+	{
+		std::println("Testing BasicWindowHostPool");
+
+		Elos::BasicWindowHostPool<Host> pool(3);
+		assert(pool.GetHosts().size() == 3 && "The pool should start one host per thread");
+
+		std::vector<StandInWindow> windows(9);
+		std::set<std::thread::id> threads;
+		for (StandInWindow& window : windows)
+		{
+			std::shared_ptr<Host> host = pool.Pick();
+			const Elos::WindowId id = host->Attach(window);
+			host->PostAndWait(id, Elos::WindowCommand::Redraw{});
+			threads.insert(*window.Threads.begin());
+		}
+
+		assert(threads.size() == 3 && "Windows should spread over every host");
+		for (const std::shared_ptr<Host>& host : pool.GetHosts())
+		{
+			assert(host->GetWindowCount() == 3 && "Pick should balance windows across hosts");
+		}
+
+		std::println("BasicWindowHostPool passed!");
+	};
+
+	const auto TestDeferredFlush = []()
+	{
+		std::println("Testing BasicWindowHost deferred flushes");
+
+		FlushingHost host;
+		FlushingWindow window;
+		const Elos::WindowId id = host.Attach(window);
+
+		// Ids without a window, e.g. one detached before its flush, are skipped
+		window.Defer = [&]() { host.DeferFlush(id); host.DeferFlush(id + 100); };
+
+		host.PostAndWait(id, Elos::WindowCommand::Redraw{});
+		host.PostAndWait(id, Elos::WindowCommand::SetPosition{ { 1, 1 } });
+		Elos::BasicWindowCommandBatch<FlushingHost>(&host, id).SetSize({ 1, 1 }).Redraw().Submit().Wait();
+
+		// Flushes follow the pass's messages, so they are done once a later pass has run a command
+		host.PostAndWait(id, Elos::WindowCommand::RequestFocus{});
+		assert(window.Flushes >= 3 && "Every pass that deferred a flush should flush");
+
+		const Elos::u32 flushes = window.Flushes.load();
+		host.Detach(id);
+		host.PostAndWait(id, Elos::WindowCommand::Redraw{});
+		assert(window.Flushes <= flushes + 1 && "A detached window shouldn't be flushed again");
+
+		std::println("BasicWindowHost deferred flushes passed!");
+	};
+
+	const auto TestCommandOrder = []()
+	{
+		std::println("Testing BasicWindowHost command order");
+
+		OrderedHost host;
+		OrderedWindow window;
+		const Elos::WindowId id = host.Attach(window);
+
+		// One batch is drained in one pass, so only the command order decides what runs first
+		Elos::BasicWindowCommandBatch<OrderedHost>(&host, id).Redraw().SetVisible(true).RequestFocus().SetTitle("Closing").Submit().Wait();
+		host.PostAndWait(id, Elos::WindowCommand::Close{});
+
+		const std::vector<Elos::WindowCommandType> expected
+		{
+			Elos::WindowCommandType::SetVisible,
+			Elos::WindowCommandType::RequestFocus,
+			Elos::WindowCommandType::SetTitle,
+			Elos::WindowCommandType::Redraw,
+			Elos::WindowCommandType::Close
+		};
+		assert(window.Order == expected && "A window should be shown before it is focused, with only the redraw trailing");
+
+		std::println("BasicWindowHost command order passed!");
+	};
+
+	const auto TestUnwaitedErrors = []()
+	{
+		std::println("Testing BasicWindowHost errors without a waiter");
+
+		Host host;
+		StandInWindow failing;
+		StandInWindow healthy;
+		failing.FailCreate = true;
+		const Elos::WindowId failingId = host.Attach(failing);
+		const Elos::WindowId healthyId = host.Attach(healthy);
+
+		std::vector<Elos::WindowId> reported;
+		host.SetCommandErrorHandler([&reported](Elos::WindowId id, std::exception_ptr error)
+		{
+			assert(error && "The handler should get the exception");
+			reported.push_back(id);
+		});
+
+		// The throwing Create sits in the middle of a batch; everything around it must still run
+		std::vector<Elos::WindowCommand::Payload> commands;
+		commands.emplace_back(Elos::WindowCommand::SetSize{ { 1, 1 } });
+		commands.emplace_back(Elos::WindowCommand::Create{});
+		commands.emplace_back(Elos::WindowCommand::Close{});
+		host.Post(healthyId, Elos::WindowCommand::Redraw{});
+		host.Submit(failingId, commands).Wait();
+		host.PostAndWait(healthyId, Elos::WindowCommand::RequestFocus{});
+
+		assert(failing.Executed == 2 && "Commands after the throwing one should still run");
+		assert(healthy.Executed == 2 && "Other windows should be unaffected");
+		assert(host.GetFailedCommandCount(failingId) == 1 && "The failure should be counted");
+		assert(host.GetFailedCommandCount(healthyId) == 0 && "Only the failing window should count it");
+		assert(reported == std::vector<Elos::WindowId>({ failingId }) && "The handler should see the failing window");
+
+		// Without a handler the failure is only counted, and the host keeps running
+		host.SetCommandErrorHandler(nullptr);
+		host.Post(failingId, Elos::WindowCommand::Create{});
+		host.PostAndWait(failingId, Elos::WindowCommand::Redraw{});
+		assert(host.GetFailedCommandCount(failingId) == 2 && "Every failure should be counted");
+		assert(failing.Executed == 3 && "The host should keep running the window's commands");
+
+		std::println("BasicWindowHost errors without a waiter passed!");
+	};
+
+	const auto TestUnlockedExecution = []()
+	{
+		std::println("Testing BasicWindowHost runs targets without its lock");
+
+		BlockingHost host;
+		BlockingWindow slow;
+		BlockingWindow other;
+		const Elos::WindowId slowId = host.Attach(slow);
+
+		host.Post(slowId, Elos::WindowCommand::Redraw{});
+		slow.WaitUntilEntered();
+
+		// None of these may wait for the command the host thread is stuck in
+		const Elos::WindowId otherId = host.Attach(other);
+		assert(host.GetWindowCount() == 2 && "Attach should not wait on a running command");
+		assert(host.GetElidedCommandCount(slowId) == 0 && "Counters should not wait on a running command");
+		host.Detach(otherId);
+
+		// Detaching the busy window has to wait until the host is done with it
+		std::atomic<bool> detached{ false };
+		std::thread detacher([&]()
+		{
+			host.Detach(slowId);
+			assert(slow.Finished && "Detach must not return while the target is running");
+			detached = true;
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		assert(!detached && "Detach should wait for the running command");
+		slow.Release();
+		detacher.join();
+		assert(detached && host.GetWindowCount() == 0 && "Detach should finish once the command returns");
+
+		std::println("BasicWindowHost runs targets without its lock passed!");
+	};
+
+	TestRouting();
+	TestPerWindowCoalescing();
+	TestDetachAndErrors();
+	TestThreadHooks();
+	TestCommandBatch();
+	TestConcurrentBatches();
+	TestPool();
+	TestDeferredFlush();
+	TestCommandOrder();
+	TestUnwaitedErrors();
+	TestUnlockedExecution();
+
+	return 0;
+}
@@ -0,0 +1,209 @@
+#include <Elos/Window/WindowLoop.h>
+#include <Elos/Containers/ThreadSafeQueue.h>
+#include <print>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// Stands in for a thread's OS message queue: one mutex and condition variable guard both the
+	// posted messages and the wake signal, like MsgWaitForMultipleObjects waits on both at once
+	class FakeMessageSource
+	{
+	public:
+		static constexpr int Quit = -1;
+
+		void Post(int message)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_messages.push_back(message);
+			}
+			m_condVar.notify_one();
+		}
+
+		bool PumpMessages()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			while (!m_messages.empty())
+			{
+				const int message = m_messages.front();
+				m_messages.pop_front();
+				if (message == Quit)
+				{
+					return false;
+				}
+				m_dispatched.push_back(message);
+			}
+			return true;
+		}
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled || !m_messages.empty(); });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+				++m_signals;
+			}
+			m_condVar.notify_one();
+		}
+
+		std::vector<int> GetDispatched() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_dispatched;
+		}
+
+		Elos::u64 GetSignalCount() const
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_signals;
+		}
+
+	private:
+		mutable std::mutex      m_mutex;
+		std::condition_variable m_condVar;
+		std::deque<int>         m_messages;
+		std::vector<int>        m_dispatched;
+		bool                    m_signaled = false;
+		Elos::u64               m_signals  = 0;
+	};
+
+	// Waits for value to reach target, false if that takes longer than a second
+	bool WaitForCount(const std::atomic<Elos::u64>& value, Elos::u64 target)
+	{
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+		while (value.load() < target)
+		{
+			if (std::chrono::steady_clock::now() > deadline)
+			{
+				return false;
+			}
+			std::this_thread::yield();
+		}
+		return true;
+	}
+}
+
+int main()
+{
+	const auto TestCommandsWakeLoop = []()
+	{
+		std::println("Testing WindowLoop command wakeups");
+
+		FakeMessageSource source;
+		Elos::WindowLoop<FakeMessageSource> loop(source);
+		Elos::ThreadSafeQueue<Elos::u64> commands;
+		std::atomic<Elos::u64> processed{ 0 };
+
+		std::thread windowThread([&]()
+		{
+			loop.Run([&]()
+			{
+				while (commands.TryPop())
+				{
+					processed.fetch_add(1);
+				}
+			});
+		});
+
+		// Every command is picked up without polling, whichever point of the pass it lands in
+		constexpr Elos::u64 count = 20'000;
+		for (Elos::u64 i = 0; i < count; ++i)
+		{
+			commands.Push(i);
+			loop.Notify();
+			if (i % 64 == 0)
+			{
+				assert(WaitForCount(processed, i + 1) && "A notified command should be processed");
+			}
+		}
+		assert(WaitForCount(processed, count) && "No wakeup should be lost");
+		assert(source.GetSignalCount() <= count && "Notify shouldn't signal more than once per command");
+
+		loop.Stop();
+		windowThread.join();
+		assert(!loop.IsRunning() && "Stop should end Run");
+
+		std::println("WindowLoop command wakeups passed!");
+	};
+
+	const auto TestMessagesAndIdle = []()
+	{
+		std::println("Testing WindowLoop messages and idling");
+
+		FakeMessageSource source;
+		Elos::WindowLoop<FakeMessageSource> loop(source);
+		std::atomic<Elos::u64> afterMessages{ 0 };
+		std::thread windowThread([&]() { loop.Run([]() {}, [&]() { afterMessages.fetch_add(1); }); });
+
+		// An idle window sleeps in its one wait rather than polling
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		const Elos::u64 idlePasses = loop.GetPassCount();
+		assert(idlePasses <= 1 && "An idle loop shouldn't wake on its own");
+
+		source.Post(1);
+		source.Post(2);
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+		while (source.GetDispatched().size() < 2 && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+		assert((source.GetDispatched() == std::vector<int>{ 1, 2 }) && "Messages should wake the loop and be dispatched in order");
+
+		source.Post(FakeMessageSource::Quit);
+		windowThread.join();
+		assert(!loop.IsRunning() && "A quit message should end Run");
+		assert(afterMessages.load() == loop.GetPassCount() && "afterMessages should run once every pass, the last included");
+
+		std::println("WindowLoop messages and idling passed!");
+	};
+
+	const auto TestNotifyCoalesces = []()
+	{
+		std::println("Testing WindowLoop signal coalescing");
+
+		FakeMessageSource source;
+		Elos::WindowLoop<FakeMessageSource> loop(source);
+		loop.Notify();
+		loop.Notify();
+		loop.Notify();
+		assert(source.GetSignalCount() == 1 && "Notifies before the loop wakes should share one signal");
+
+		// The pass clears the pending wake, so the next Notify signals again
+		int passes = 0;
+		loop.Run([&]()
+		{
+			if (++passes == 1)
+			{
+				loop.Notify();
+			}
+			else
+			{
+				loop.Stop();
+			}
+		});
+		assert(passes == 2 && source.GetSignalCount() == 3 && "A Notify during a pass should wake the next one");
+
+		std::println("WindowLoop signal coalescing passed!");
+	};
+
+	TestCommandsWakeLoop();
+	TestMessagesAndIdle();
+	TestNotifyCoalesces();
+
+	return 0;
+}
@@ -0,0 +1,229 @@
+#include <Elos/Window/BasicWindowHost.h>
+#include <Elos/Window/BasicWindowPool.h>
+#include <print>
+#include <cassert>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	// A message queue that never has messages, only the wake signal
+	class StandInMessageSource
+	{
+	public:
+		bool PumpMessages() { return true; }
+
+		void Wait()
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condVar.wait(lock, [this] { return m_signaled; });
+			m_signaled = false;
+		}
+
+		void Signal()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_signaled = true;
+			}
+			m_condVar.notify_one();
+		}
+
+	private:
+		std::mutex              m_mutex;
+		std::condition_variable m_condVar;
+		bool                    m_signaled = false;
+	};
+
+	// What the host thread sees of a window
+	struct StandInState
+	{
+		Elos::String         Title;
+		Elos::WindowSize     Size{ 0, 0 };
+		Elos::WindowPosition Position{ 0, 0 };
+		bool                 Visible = false;
+		bool                 Open    = false;
+		std::atomic<int>     Events{ 0 };  // Queued for the window's consumer, like a real window's Resized or FocusGained
+
+		void Execute(const Elos::WindowCommand::Create& cmd)
+		{
+			Title    = cmd.Info.Title;
+			Size     = cmd.Info.Size;
+			Position = cmd.Info.Position;
+			Visible  = cmd.Info.Visible;
+			Open     = true;
+		}
+
+		void Execute(const Elos::WindowCommand::Close&) { Open = false; }
+		void Execute(const Elos::WindowCommand::SetTitle& cmd) { Title.assign(cmd.Title.View()); }
+		void Execute(const Elos::WindowCommand::SetSize& cmd) { Size = cmd.Size; Events.fetch_add(1); }
+		void Execute(const Elos::WindowCommand::SetPosition& cmd) { Position = cmd.Position; }
+		void Execute(const Elos::WindowCommand::SetVisible& cmd) { Visible = cmd.Visible; Events.fetch_add(1); }
+		void Execute(const auto&) {}
+	};
+
+	using Host = Elos::BasicWindowHost<StandInMessageSource, StandInState>;
+
+	std::atomic<int> g_created{ 0 };
+
+	// Stands in for Window: created on a host with Create, reconfigured through command batches
+	class StandInWindow
+	{
+	public:
+		explicit StandInWindow(const Elos::WindowCreateInfo& info)
+		{
+			m_id = s_host->Attach(m_state);
+			s_host->PostAndWait(m_id, Elos::WindowCommand::Create{ info });
+			g_created.fetch_add(1);
+		}
+
+		~StandInWindow() { s_host->Detach(m_id); }
+
+		NODISCARD bool IsOpen() const { return m_state.Open; }
+		NODISCARD Elos::BasicWindowCommandBatch<Host> BeginCommands() { return { s_host.get(), m_id }; }
+		void DiscardEvents() { ++DiscardCount; m_state.Events = 0; }
+		NODISCARD int GetEventCount() const { return m_state.Events.load(); }
+		void Close() { s_host->PostAndWait(m_id, Elos::WindowCommand::Close{}); }
+
+		// Only read once a batch has completed
+		NODISCARD const StandInState& GetState() const { return m_state; }
+
+		int DiscardCount = 0;
+
+		static inline std::unique_ptr<Host> s_host;
+
+	private:
+		StandInState   m_state;
+		Elos::WindowId m_id = 0;
+	};
+
+	using Pool = Elos::BasicWindowPool<StandInWindow>;
+}
+
+int main()
+{
+	StandInWindow::s_host = std::make_unique<Host>();
+
+	const auto TestPrewarmAndReuse = []()
+	{
+		std::println("Testing BasicWindowPool prewarm and reuse");
+
+		const int createdBefore = g_created.load();
+		Pool pool(Elos::WindowCreateInfo::Default("Prototype", { 10, 10 }), 2);
+		assert(pool.GetIdleCount() == 2 && g_created.load() == createdBefore + 2 && "The pool should prewarm up to its capacity");
+
+		std::shared_ptr<StandInWindow> window = pool.Acquire(Elos::WindowCreateInfo::Default("Tooltip", { 200, 40 }));
+		assert(g_created.load() == createdBefore + 2 && "A hit must not create a window");
+		assert(window->GetState().Visible && window->GetState().Title == "Tooltip" && window->GetState().Size.Width == 200 && "Acquire should reconfigure and show the window");
+		assert(window->DiscardCount == 1 && "Acquire should drop events from while the window was hidden");
+		assert(window->GetEventCount() == 2 && "Events caused by Acquire's own batch should reach the caller");
+
+		StandInWindow* const address = window.get();
+		pool.Release(std::move(window));
+		assert(pool.GetIdleCount() == 2 && "Release should return the window");
+
+		Elos::WindowCreateInfo placed = Elos::WindowCreateInfo::Default("Menu", { 100, 300 });
+		placed.Position = { 5, 6 };
+		std::shared_ptr<StandInWindow> again = pool.Acquire(placed);
+		assert(again.get() == address && "The most recently released window should be handed out again");
+		assert(again->GetState().Position.X == 5 && again->GetState().Title == "Menu" && "A released window should take the new settings");
+
+		const Elos::WindowPoolStats stats = pool.GetStats();
+		assert(stats.Hits == 2 && stats.Misses == 0 && stats.Recycled == 1 && stats.HitRate() == 1.0 && "Both acquires should be hits");
+		assert(stats.AcquireLatency.Count == 2 && stats.AcquireLatency.PercentileNs(0.5) > 0 && "Every acquire should be timed");
+
+		std::println("BasicWindowPool prewarm and reuse passed!");
+	};
+
+	const auto TestMissesAndDiscards = []()
+	{
+		std::println("Testing BasicWindowPool misses and discards");
+
+		Pool pool(Elos::WindowCreateInfo::Default("Prototype", { 10, 10 }), 1);
+		std::shared_ptr<StandInWindow> warm = pool.Acquire(Elos::WindowCreateInfo::Default("A", { 1, 1 }));
+
+		const int createdBefore = g_created.load();
+		std::shared_ptr<StandInWindow> cold = pool.Acquire(Elos::WindowCreateInfo::Default("B", { 1, 1 }));
+		assert(g_created.load() == createdBefore + 1 && cold->GetState().Visible && "An empty pool should create a visible window");
+
+		std::shared_ptr<StandInWindow> other = pool.Acquire(Elos::WindowCreateInfo::Default("C", { 1, 1 }, Elos::WindowStyle::None));
+		assert(g_created.load() == createdBefore + 2 && "A different style can't reuse a pooled window");
+
+		warm->Close();
+		pool.Release(std::move(warm));
+		assert(pool.GetIdleCount() == 0 && "A closed window must not be kept");
+
+		pool.Release(std::move(cold));
+		assert(pool.GetIdleCount() == 1 && "A window created on a miss can still be recycled");
+
+		pool.Release(std::move(other));
+		assert(pool.GetIdleCount() == 1 && "Windows built unlike the prototype must not be kept");
+
+		const Elos::WindowPoolStats stats = pool.GetStats();
+		assert(stats.Hits == 1 && stats.Misses == 2 && stats.Recycled == 1 && stats.Discarded == 2 && "Stats should count every acquire and release");
+
+		std::println("BasicWindowPool misses and discards passed!");
+	};
+
+	const auto TestDroppedWindows = []()
+	{
+		std::println("Testing BasicWindowPool windows dropped without release");
+
+		Pool pool(Elos::WindowCreateInfo::Default("Prototype", { 10, 10 }), 1);
+		for (int i = 0; i < 8; ++i)
+		{
+			// Freed without Release, so a later window may well get the same address
+			std::shared_ptr<StandInWindow> dropped = pool.Acquire(Elos::WindowCreateInfo::Default("Dropped", { 1, 1 }));
+			dropped.reset();
+
+			auto outsider = std::make_shared<StandInWindow>(Elos::WindowCreateInfo::Default("Outsider", { 1, 1 }));
+			pool.Release(std::move(outsider));
+			assert(pool.GetIdleCount() == 0 && "A window the pool didn't hand out must not be kept");
+		}
+		assert(pool.GetStats().Discarded == 8 && "Every foreign release should be discarded");
+
+		std::println("BasicWindowPool windows dropped without release passed!");
+	};
+
+	const auto TestConcurrentAcquire = []()
+	{
+		std::println("Testing BasicWindowPool concurrent acquire");
+
+		Pool pool(Elos::WindowCreateInfo::Default("Prototype", { 10, 10 }), 4);
+		std::vector<std::thread> threads;
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&]()
+			{
+				for (int i = 0; i < 100; ++i)
+				{
+					std::shared_ptr<StandInWindow> window = pool.Acquire(Elos::WindowCreateInfo::Default("Popup", { 50, 50 }));
+					assert(window->GetState().Visible && "Every acquired window should be shown");
+					pool.Release(std::move(window));
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		const Elos::WindowPoolStats stats = pool.GetStats();
+		assert(stats.Hits + stats.Misses == 400 && stats.Recycled + stats.Discarded == 400 && "Every acquire and release should be counted");
+		assert(pool.GetIdleCount() <= pool.GetCapacity() && "The pool must not grow past its capacity");
+
+		std::println("BasicWindowPool concurrent acquire passed!");
+	};
+
+	TestPrewarmAndReuse();
+	TestMissesAndDiscards();
+	TestDroppedWindows();
+	TestConcurrentAcquire();
+
+	StandInWindow::s_host.reset();
+	return 0;
+}
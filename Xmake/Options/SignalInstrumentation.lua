@@ -0,0 +1,7 @@
+option("SignalInstrumentation")
+	set_showmenu(true)
+	set_default(false)
+	set_description("Record per-slot call counts and timings for Elos::Signal")
+	set_category("root Elos")
+	add_defines("ELOS_SIGNAL_INSTRUMENTATION=1")
+option_end()
\ No newline at end of file
@@ -25,6 +25,9 @@ if is_mode("release") then
 	set_strip("all")
 end
 
+-- Must apply to every target since Signal is header-only
+add_options("SignalInstrumentation")
+
 add_defines("UNICODE", "_UNICODE", "NOMINMAX", "NOMCX", "NOSERVICE", "NOHELP", "WIN32_LEAN_AND_MEAN")
 
 add_requires("directxtk")
@@ -75,4 +78,18 @@ for _, test_dir in ipairs(os.dirs(path.join(test_path, "*"))) do
 			add_tests("Run" .. test_name, { run_timeout = 2000 })
 		end
 	target_end()
-end
\ No newline at end of file
+end
+
+
+local bench_path = path.join(os.projectdir(), "Bench")
+for _, bench_dir in ipairs(os.dirs(path.join(bench_path, "*"))) do
+	local bench_name = path.basename(bench_dir)
+
+	target(bench_name)
+		set_group("Elos/Benchmarks")
+		add_files(bench_dir .. "**.cpp")
+		add_deps("Elos")
+		add_defines("ELOS_BENCHMARK")
+		add_tests("CompileSuccess", { build_should_pass = true, group = "Compilation" })
+	target_end()
+end